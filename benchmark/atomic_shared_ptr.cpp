@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+#include <isl/atomic_shared_ptr.hpp>
+
+struct RoutingTable
+{
+    std::array<std::size_t, 8> routes{};
+};
+
+using RoutingFrame = isl::SharedPtrFrameFor<RoutingTable>;
+
+// NOLINTNEXTLINE
+static constinit auto RoutingAllocator =
+    isl::PoolAllocator<sizeof(RoutingFrame), alignof(RoutingFrame)>{};
+
+using RoutingPtr = isl::SharedPtr<RoutingTable, RoutingFrame, &RoutingAllocator>;
+
+// NOLINTNEXTLINE
+static auto RoutingSlot =
+    isl::AtomicSharedPtr<RoutingTable, RoutingFrame, &RoutingAllocator>{RoutingPtr{RoutingTable{}}};
+
+// NOLINTNEXTLINE
+static auto StdRoutingSlot = std::make_shared<RoutingTable>();
+
+static void islAtomicSharedPtrRead(benchmark::State &state)
+{
+    for (auto _ : state) {
+        const auto snapshot = RoutingSlot.read();
+        benchmark::DoNotOptimize(snapshot->routes[0]);
+    }
+}
+
+BENCHMARK(islAtomicSharedPtrRead)->ThreadRange(1, 64)->UseRealTime();
+
+static void islAtomicSharedPtrLoad(benchmark::State &state)
+{
+    for (auto _ : state) {
+        const auto ptr = RoutingSlot.load();
+        benchmark::DoNotOptimize(ptr->routes[0]);
+    }
+}
+
+BENCHMARK(islAtomicSharedPtrLoad)->ThreadRange(1, 64)->UseRealTime();
+
+static void stdAtomicLoadSharedPtr(benchmark::State &state)
+{
+    for (auto _ : state) {
+        const auto ptr = std::atomic_load(&StdRoutingSlot);
+        benchmark::DoNotOptimize(ptr->routes[0]);
+    }
+}
+
+BENCHMARK(stdAtomicLoadSharedPtr)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,135 @@
+#include <ankerl/unordered_dense.h>
+#include <benchmark/benchmark.h>
+#include <isl/flat_hash_map.hpp>
+#include <isl/flat_map.hpp>
+#include <map>
+#include <random>
+
+static auto generateKeys(const std::size_t count) -> std::vector<std::string>
+{
+    auto keys = std::vector<std::string>{};
+    keys.reserve(count);
+
+    for (std::size_t i = 0; i != count; ++i) {
+        keys.emplace_back(fmt::format("identifier_{}", i * 7919));
+    }
+
+    return keys;
+}
+
+// Looks up every key in random order, half of the lookups miss.
+template<typename Map>
+static auto lookupBenchmark(benchmark::State &state) -> void
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const auto keys = generateKeys(count * 2);
+
+    auto map = Map{};
+
+    for (std::size_t i = 0; i != count; ++i) {
+        map[keys[i]] = i;
+    }
+
+    auto lookups = std::vector<isl::string_view>(keys.begin(), keys.end());
+    std::ranges::shuffle(lookups, std::mt19937{42});// NOLINT
+
+    for (auto _ : state) {
+        auto found = std::size_t{};
+
+        for (const auto key : lookups) {
+            if constexpr (requires { map.find(key); }) {
+                found += static_cast<std::size_t>(map.find(key) != map.end());
+            } else {
+                found += static_cast<std::size_t>(
+                    map.find(static_cast<std::string_view>(key)) != map.end());
+            }
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(lookups.size()));
+}
+
+template<typename Map>
+static auto integerLookupBenchmark(benchmark::State &state) -> void
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto engine = std::mt19937{42};// NOLINT
+
+    auto map = Map{};
+    auto lookups = std::vector<std::uint64_t>{};
+
+    for (std::size_t i = 0; i != count; ++i) {
+        const auto key = std::uint64_t{engine()};
+        map[key] = i;
+        lookups.emplace_back(key);
+        lookups.emplace_back(key + 1);
+    }
+
+    std::ranges::shuffle(lookups, engine);
+
+    for (auto _ : state) {
+        auto found = std::size_t{};
+
+        for (const auto key : lookups) {
+            found += static_cast<std::size_t>(map.find(key) != map.end());
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(lookups.size()));
+}
+
+static void stdMapStringLookup(benchmark::State &state)
+{
+    lookupBenchmark<std::map<std::string, std::size_t, std::less<>>>(state);
+}
+
+static void islFlatMapStringLookup(benchmark::State &state)
+{
+    lookupBenchmark<isl::FlatMap<std::string, std::size_t>>(state);
+}
+
+static void islFlatHashMapStringLookup(benchmark::State &state)
+{
+    lookupBenchmark<isl::FlatHashMap<std::string, std::size_t>>(state);
+}
+
+static void ankerlMapStringLookup(benchmark::State &state)
+{
+    lookupBenchmark<ankerl::unordered_dense::map<
+        std::string, std::size_t, isl::detail::FlatHashMapHash<std::string>, std::equal_to<>>>(
+        state);
+}
+
+static void stdMapIntegerLookup(benchmark::State &state)
+{
+    integerLookupBenchmark<std::map<std::uint64_t, std::size_t>>(state);
+}
+
+static void islFlatMapIntegerLookup(benchmark::State &state)
+{
+    integerLookupBenchmark<isl::FlatMap<std::uint64_t, std::size_t>>(state);
+}
+
+static void islFlatHashMapIntegerLookup(benchmark::State &state)
+{
+    integerLookupBenchmark<isl::FlatHashMap<std::uint64_t, std::size_t>>(state);
+}
+
+static void ankerlMapIntegerLookup(benchmark::State &state)
+{
+    integerLookupBenchmark<ankerl::unordered_dense::map<std::uint64_t, std::size_t>>(state);
+}
+
+BENCHMARK(stdMapStringLookup)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK(islFlatMapStringLookup)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK(islFlatHashMapStringLookup)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK(ankerlMapStringLookup)->RangeMultiplier(10)->Range(100, 10'000);
+
+BENCHMARK(stdMapIntegerLookup)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK(islFlatMapIntegerLookup)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK(islFlatHashMapIntegerLookup)->RangeMultiplier(10)->Range(100, 10'000);
+BENCHMARK(ankerlMapIntegerLookup)->RangeMultiplier(10)->Range(100, 10'000);
@@ -0,0 +1,117 @@
+#include <ankerl/unordered_dense.h>
+#include <benchmark/benchmark.h>
+#include <isl/perfect_hash_map.hpp>
+#include <isl/static_flat_map.hpp>
+#include <random>
+
+using namespace isl::string_view_literals;
+
+static constexpr std::size_t KeywordsCount = 100;
+
+static constexpr auto Keywords = std::array<isl::string_view, KeywordsCount>{
+    "alignas"_sv,      "alignof"_sv,      "and"_sv,          "and_eq"_sv,       "asm"_sv,
+    "auto"_sv,         "bitand"_sv,       "bitor"_sv,        "bool"_sv,         "break"_sv,
+    "case"_sv,         "catch"_sv,        "char"_sv,         "char8_t"_sv,      "char16_t"_sv,
+    "char32_t"_sv,     "class"_sv,        "compl"_sv,        "concept"_sv,      "const"_sv,
+    "consteval"_sv,    "constexpr"_sv,    "constinit"_sv,    "const_cast"_sv,   "continue"_sv,
+    "co_await"_sv,     "co_return"_sv,    "co_yield"_sv,     "decltype"_sv,     "default"_sv,
+    "delete"_sv,       "do"_sv,           "double"_sv,       "dynamic_cast"_sv, "else"_sv,
+    "enum"_sv,         "explicit"_sv,     "export"_sv,       "extern"_sv,       "false"_sv,
+    "float"_sv,        "for"_sv,          "friend"_sv,       "goto"_sv,         "if"_sv,
+    "inline"_sv,       "int"_sv,          "long"_sv,         "mutable"_sv,      "namespace"_sv,
+    "new"_sv,          "noexcept"_sv,     "not"_sv,          "not_eq"_sv,       "nullptr"_sv,
+    "operator"_sv,     "or"_sv,           "or_eq"_sv,        "private"_sv,      "protected"_sv,
+    "public"_sv,       "register"_sv,     "reinterpret_cast"_sv, "requires"_sv, "return"_sv,
+    "short"_sv,        "signed"_sv,       "sizeof"_sv,       "static"_sv,       "static_assert"_sv,
+    "static_cast"_sv,  "struct"_sv,       "switch"_sv,       "template"_sv,     "this"_sv,
+    "thread_local"_sv, "throw"_sv,        "true"_sv,         "try"_sv,          "typedef"_sv,
+    "typeid"_sv,       "typename"_sv,     "union"_sv,        "unsigned"_sv,     "using"_sv,
+    "virtual"_sv,      "void"_sv,         "volatile"_sv,     "wchar_t"_sv,      "while"_sv,
+    "xor"_sv,          "xor_eq"_sv,       "final"_sv,        "override"_sv,     "import"_sv,
+    "module"_sv,       "transaction_safe"_sv, "atomic_cancel"_sv, "atomic_commit"_sv,
+    "reflexpr"_sv,
+};
+
+static constexpr auto PerfectKeywords = []() consteval {
+    using Map = isl::PerfectHashMap<isl::string_view, std::size_t, KeywordsCount>;
+    auto data = std::array<Map::value_type, KeywordsCount>{};
+
+    for (std::size_t i = 0; i != KeywordsCount; ++i) {
+        data[i] = {Keywords[i], i};
+    }
+
+    return Map{data};
+}();
+
+static constexpr auto FlatmapKeywords = [] {
+    auto map = isl::StaticFlatmap<isl::string_view, std::size_t, KeywordsCount>{};
+
+    for (std::size_t i = 0; i != KeywordsCount; ++i) {
+        map.tryEmplace(Keywords[i], i);
+    }
+
+    return map;
+}();
+
+// Half of the tokens are keywords, the other half are identifiers.
+static auto generateTokens() -> std::vector<isl::string_view>
+{
+    static const auto identifiers = [] {
+        auto result = std::vector<std::string>{};
+
+        for (const auto keyword : Keywords) {
+            result.emplace_back(fmt::format("{}_", keyword));
+        }
+
+        return result;
+    }();
+
+    auto tokens = std::vector<isl::string_view>(Keywords.begin(), Keywords.end());
+    tokens.insert(tokens.end(), identifiers.begin(), identifiers.end());
+    std::ranges::shuffle(tokens, std::mt19937{42});// NOLINT
+
+    return tokens;
+}
+
+template<typename Map>
+static auto keywordLookup(benchmark::State &state, const Map &map) -> void
+{
+    const auto tokens = generateTokens();
+
+    for (auto _ : state) {
+        auto found = std::size_t{};
+
+        for (const auto token : tokens) {
+            found += static_cast<std::size_t>(map.contains(token));
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(tokens.size()));
+}
+
+static void perfectHashMapKeywordLookup(benchmark::State &state)
+{
+    keywordLookup(state, PerfectKeywords);
+}
+
+static void staticFlatmapKeywordLookup(benchmark::State &state)
+{
+    keywordLookup(state, FlatmapKeywords);
+}
+
+static void ankerlMapKeywordLookup(benchmark::State &state)
+{
+    auto map = ankerl::unordered_dense::map<isl::string_view, std::size_t>{};
+
+    for (std::size_t i = 0; i != KeywordsCount; ++i) {
+        map.emplace(Keywords[i], i);
+    }
+
+    keywordLookup(state, map);
+}
+
+BENCHMARK(perfectHashMapKeywordLookup);
+BENCHMARK(staticFlatmapKeywordLookup);
+BENCHMARK(ankerlMapKeywordLookup);
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <functional>
+#include <isl/small_function.hpp>
+
+static constexpr std::size_t CallsCount = 1024;
+
+static auto addToState(std::size_t value) -> std::size_t
+{
+    benchmark::DoNotOptimize(value);
+    return value + 1;
+}
+
+template <typename Function>
+static auto callRepeatedly(benchmark::State &state, const Function &function) -> void
+{
+    for (auto _ : state) {
+        auto result = std::size_t{};
+
+        for (std::size_t i = 0; i != CallsCount; ++i) {
+            result += function(i);
+        }
+
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(CallsCount));
+}
+
+static void functionPointerCall(benchmark::State &state)
+{
+    auto *function = &addToState;
+    benchmark::DoNotOptimize(function);
+
+    callRepeatedly(state, function);
+}
+
+BENCHMARK(functionPointerCall);
+
+static void stdFunctionCall(benchmark::State &state)
+{
+    const auto function = std::function<std::size_t(std::size_t)>{&addToState};
+    callRepeatedly(state, function);
+}
+
+BENCHMARK(stdFunctionCall);
+
+#if defined(__cpp_lib_move_only_function) && __cpp_lib_move_only_function >= 202110L
+static void stdMoveOnlyFunctionCall(benchmark::State &state)
+{
+    const auto function = std::move_only_function<std::size_t(std::size_t) const>{&addToState};
+    callRepeatedly(state, function);
+}
+
+BENCHMARK(stdMoveOnlyFunctionCall);
+#endif
+
+static void islSmallFunctionCall(benchmark::State &state)
+{
+    const auto function = isl::SmallFunction<std::size_t(std::size_t)>{&addToState};
+    callRepeatedly(state, function);
+}
+
+BENCHMARK(islSmallFunctionCall);
+
+static void islSmallFunctionCaptureCall(benchmark::State &state)
+{
+    auto offset = std::size_t{1};
+    benchmark::DoNotOptimize(offset);
+
+    const auto function = isl::SmallFunction<std::size_t(std::size_t)>{
+        [offset](std::size_t value) { return addToState(value) + offset; }};
+
+    callRepeatedly(state, function);
+}
+
+BENCHMARK(islSmallFunctionCaptureCall);
+
+static void stdFunctionCaptureCall(benchmark::State &state)
+{
+    auto offset = std::size_t{1};
+    benchmark::DoNotOptimize(offset);
+
+    const auto function = std::function<std::size_t(std::size_t)>{
+        [offset](std::size_t value) { return addToState(value) + offset; }};
+
+    callRepeatedly(state, function);
+}
+
+BENCHMARK(stdFunctionCaptureCall);
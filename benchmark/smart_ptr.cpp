@@ -131,3 +131,69 @@ static void stdSharedPtrMove(benchmark::State &state)
 }
 
 BENCHMARK(stdSharedPtrMove);
+
+template<isl::RefCountPolicy Policy>
+using PolicyFrame = isl::SharedPtrFrameWithPolicyFor<Policy, std::string>;
+
+template<isl::RefCountPolicy Policy>
+// NOLINTNEXTLINE
+static constinit auto PolicyAllocator =
+    isl::PoolAllocator<sizeof(PolicyFrame<Policy>), alignof(PolicyFrame<Policy>)>{};
+
+template<isl::RefCountPolicy Policy>
+using PolicySharedPtr = isl::SharedPtr<std::string, PolicyFrame<Policy>, &PolicyAllocator<Policy>>;
+
+template<isl::RefCountPolicy Policy>
+static void islSharedPtrCopyWithPolicy(benchmark::State &state)
+{
+    const auto ptr = PolicySharedPtr<Policy>{"Hello, World!"};
+
+    for (auto _ : state) {
+        auto copy = ptr;
+        benchmark::DoNotOptimize(copy);
+    }
+}
+
+BENCHMARK(islSharedPtrCopyWithPolicy<isl::RefCountPolicy::SINGLE_THREADED>);
+BENCHMARK(islSharedPtrCopyWithPolicy<isl::RefCountPolicy::ATOMIC>);
+BENCHMARK(islSharedPtrCopyWithPolicy<isl::RefCountPolicy::BIASED>);
+
+template<isl::RefCountPolicy Policy>
+static void islSharedPtrConstructWithPolicy(benchmark::State &state)
+{
+    for (auto _ : state) {
+        auto pointers = std::array<PolicySharedPtr<Policy>, 1024>{};
+
+        for (auto &ptr : pointers) {
+            ptr = PolicySharedPtr<Policy>("Hello, World!");
+            benchmark::DoNotOptimize(*ptr);
+        }
+    }
+}
+
+BENCHMARK(islSharedPtrConstructWithPolicy<isl::RefCountPolicy::SINGLE_THREADED>);
+BENCHMARK(islSharedPtrConstructWithPolicy<isl::RefCountPolicy::ATOMIC>);
+BENCHMARK(islSharedPtrConstructWithPolicy<isl::RefCountPolicy::BIASED>);
+
+// Graph-like traversal: many short-lived copies of a few long-lived nodes.
+template<isl::RefCountPolicy Policy>
+static void islSharedPtrCopyBurstWithPolicy(benchmark::State &state)
+{
+    auto nodes = std::vector<PolicySharedPtr<Policy>>{};
+
+    for (std::size_t i = 0; i != 64; ++i) {
+        nodes.emplace_back(std::to_string(i));
+    }
+
+    for (auto _ : state) {
+        for (const auto &node : nodes) {
+            auto first = node;
+            auto second = first;
+            benchmark::DoNotOptimize(second);
+        }
+    }
+}
+
+BENCHMARK(islSharedPtrCopyBurstWithPolicy<isl::RefCountPolicy::SINGLE_THREADED>);
+BENCHMARK(islSharedPtrCopyBurstWithPolicy<isl::RefCountPolicy::ATOMIC>);
+BENCHMARK(islSharedPtrCopyBurstWithPolicy<isl::RefCountPolicy::BIASED>);
@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include <isl/static_flat_map.hpp>
+#include <random>
+
+static constexpr std::size_t TableSize = 64;
+
+enum struct Opcode : std::uint16_t
+{
+};
+
+template<isl::FlatmapLayout Layout>
+using OpcodeTable =
+    isl::StaticFlatmap<Opcode, std::uint64_t, TableSize, std::equal_to<>, Layout>;
+
+template<isl::FlatmapLayout Layout>
+static auto makeOpcodeTable() -> OpcodeTable<Layout>
+{
+    auto table = OpcodeTable<Layout>{};
+
+    for (std::size_t i = 0; i != TableSize; ++i) {
+        table.tryEmplace(static_cast<Opcode>(i * 13), i);
+    }
+
+    return table;
+}
+
+// Every opcode of the table is searched, a quarter of lookups miss.
+template<isl::FlatmapLayout Layout>
+static auto opcodeLookup(benchmark::State &state) -> void
+{
+    const auto table = makeOpcodeTable<Layout>();
+    auto lookups = std::vector<Opcode>{};
+
+    for (std::size_t i = 0; i != TableSize * 4 / 3; ++i) {
+        lookups.emplace_back(static_cast<Opcode>(i * 13));
+    }
+
+    std::ranges::shuffle(lookups, std::mt19937{42});// NOLINT
+
+    for (auto _ : state) {
+        auto found = std::size_t{};
+
+        for (const auto opcode : lookups) {
+            found += static_cast<std::size_t>(table.contains(opcode));
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(lookups.size()));
+}
+
+static void arrayOfStructsLookup(benchmark::State &state)
+{
+    opcodeLookup<isl::FlatmapLayout::ARRAY_OF_STRUCTS>(state);
+}
+
+static void structOfArraysLookup(benchmark::State &state)
+{
+    opcodeLookup<isl::FlatmapLayout::STRUCT_OF_ARRAYS>(state);
+}
+
+BENCHMARK(arrayOfStructsLookup);
+BENCHMARK(structOfArraysLookup);
@@ -0,0 +1,113 @@
+#include <ankerl/unordered_dense.h>
+#include <benchmark/benchmark.h>
+#include <isl/string_interner.hpp>
+#include <mutex>
+
+static constexpr std::size_t IdentifiersCount = 4096;
+
+static auto generateIdentifiers(const std::size_t seed) -> std::vector<std::string>
+{
+    auto identifiers = std::vector<std::string>{};
+    identifiers.reserve(IdentifiersCount);
+
+    for (std::size_t i = 0; i != IdentifiersCount; ++i) {
+        identifiers.emplace_back(fmt::format("identifier_{}_{}", seed, i));
+    }
+
+    return identifiers;
+}
+
+// NOLINTBEGIN
+static const auto SharedIdentifiers = generateIdentifiers(0);
+static auto Interner = std::unique_ptr<isl::StringInterner>{};
+static auto MutexMapLock = std::mutex{};
+static auto MutexMap = ankerl::unordered_dense::map<std::string, isl::SmallId>{};
+// NOLINTEND
+
+// All threads intern the same identifiers, after the first pass every call is a lookup.
+static void stringInternerLookup(benchmark::State &state)
+{
+    if (state.thread_index() == 0) {
+        Interner = std::make_unique<isl::StringInterner>();
+    }
+
+    for (auto _ : state) {
+        for (const auto &identifier : SharedIdentifiers) {
+            benchmark::DoNotOptimize(Interner->intern(identifier));
+        }
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(SharedIdentifiers.size()));
+}
+
+BENCHMARK(stringInternerLookup)->ThreadRange(1, 16)->UseRealTime();
+
+static void mutexMapLookup(benchmark::State &state)
+{
+    if (state.thread_index() == 0) {
+        MutexMap.clear();
+    }
+
+    for (auto _ : state) {
+        for (const auto &identifier : SharedIdentifiers) {
+            const auto lock = std::scoped_lock{MutexMapLock};
+            benchmark::DoNotOptimize(
+                MutexMap.try_emplace(identifier, static_cast<isl::SmallId>(MutexMap.size())));
+        }
+    }
+
+    state.SetItemsProcessed(
+        state.iterations() * static_cast<std::int64_t>(SharedIdentifiers.size()));
+}
+
+BENCHMARK(mutexMapLookup)->ThreadRange(1, 16)->UseRealTime();
+
+// Every thread inserts its own identifiers, so all calls take the exclusive shard locks.
+static void stringInternerInsert(benchmark::State &state)
+{
+    auto identifiers = std::vector<std::string>{};
+
+    for (std::size_t i = 0; i != IdentifiersCount * 16; ++i) {
+        identifiers.emplace_back(fmt::format("identifier_{}_{}", state.thread_index(), i));
+    }
+
+    if (state.thread_index() == 0) {
+        Interner = std::make_unique<isl::StringInterner>();
+    }
+
+    for (auto _ : state) {
+        for (const auto &identifier : identifiers) {
+            benchmark::DoNotOptimize(Interner->intern(identifier));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(identifiers.size()));
+}
+
+BENCHMARK(stringInternerInsert)->ThreadRange(1, 16)->Iterations(1)->UseRealTime();
+
+// Shard maps hold thousands of strings each, so the benchmark shows how keys spread inside them.
+static void stringInternerFindInLargeShards(benchmark::State &state)
+{
+    const auto interner = std::make_unique<isl::StringInterner>();
+    auto identifiers = std::vector<std::string>{};
+
+    for (std::size_t i = 0; i != IdentifiersCount * 64; ++i) {
+        identifiers.emplace_back(fmt::format("identifier_{}", i));
+    }
+
+    for (const auto &identifier : identifiers) {
+        benchmark::DoNotOptimize(interner->intern(identifier));
+    }
+
+    for (auto _ : state) {
+        for (const auto &identifier : identifiers) {
+            benchmark::DoNotOptimize(interner->find(identifier));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(identifiers.size()));
+}
+
+BENCHMARK(stringInternerFindInLargeShards);
@@ -0,0 +1,409 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <isl/code_point_index.hpp>
+#include <isl/string_view.hpp>
+#include <random>
+#include <ranges>
+#include <sstream>
+
+// Text without the searched characters, so every search scans the whole string.
+static auto makeText(const std::size_t length) -> std::string
+{
+    auto engine = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int>{'a', 'y'};
+    auto result = std::string(length, ' ');
+
+    for (auto &chr : result) {
+        chr = static_cast<char>(distribution(engine));
+    }
+
+    return result;
+}
+
+static auto setBytesProcessed(benchmark::State &state) -> void
+{
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static auto stdStringViewFind(benchmark::State &state) -> void
+{
+    const auto text = makeText(static_cast<std::size_t>(state.range(0)));
+    const auto view = std::string_view{text};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.find('z'));
+    }
+
+    setBytesProcessed(state);
+}
+
+static auto rangesFind(benchmark::State &state) -> void
+{
+    const auto text = makeText(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::ranges::find(text, 'z'));
+    }
+
+    setBytesProcessed(state);
+}
+
+static auto islStringViewFind(benchmark::State &state) -> void
+{
+    const auto text = makeText(static_cast<std::size_t>(state.range(0)));
+    const auto view = isl::string_view{text};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.find('z'));
+    }
+
+    setBytesProcessed(state);
+}
+
+static auto stdStringViewFindFirstOf(benchmark::State &state) -> void
+{
+    const auto text = makeText(static_cast<std::size_t>(state.range(0)));
+    const auto view = std::string_view{text};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.find_first_of(" \t\r\nz"));
+    }
+
+    setBytesProcessed(state);
+}
+
+static auto islStringViewFindFirstOf(benchmark::State &state) -> void
+{
+    const auto text = makeText(static_cast<std::size_t>(state.range(0)));
+    const auto view = isl::string_view{text};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.findFirstOf(" \t\r\nz"));
+    }
+
+    setBytesProcessed(state);
+}
+
+static auto stdStringViewFindSubstring(benchmark::State &state) -> void
+{
+    const auto text = makeText(static_cast<std::size_t>(state.range(0)));
+    const auto view = std::string_view{text};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.find("abcz"));
+    }
+
+    setBytesProcessed(state);
+}
+
+static auto islStringViewFindSubstring(benchmark::State &state) -> void
+{
+    const auto text = makeText(static_cast<std::size_t>(state.range(0)));
+    const auto view = isl::string_view{text};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.find(isl::string_view{"abcz"}));
+    }
+
+    setBytesProcessed(state);
+}
+
+static auto islStringViewStrip(benchmark::State &state) -> void
+{
+    const auto padding = std::string(static_cast<std::size_t>(state.range(0)) / 2, ' ');
+    const auto text = padding + "text" + padding;
+    const auto view = isl::string_view{text};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.strip(" \t\r\n"));
+    }
+
+    setBytesProcessed(state);
+}
+
+// Strings share a prefix of prefix_length characters, so comparisons scan it before the
+// first mismatch.
+static auto makeSortInput(const std::size_t count, const std::size_t prefix_length)
+    -> std::vector<std::string>
+{
+    auto engine = std::mt19937{42};
+    auto length_distribution = std::uniform_int_distribution<std::size_t>{8, 32};
+    auto character_distribution = std::uniform_int_distribution<int>{'a', 'z'};
+    auto result = std::vector<std::string>{};
+
+    for (std::size_t i = 0; i != count; ++i) {
+        auto str = std::string(prefix_length, 'p');
+
+        for (std::size_t j = length_distribution(engine); j != 0; --j) {
+            str.push_back(static_cast<char>(character_distribution(engine)));
+        }
+
+        result.emplace_back(std::move(str));
+    }
+
+    return result;
+}
+
+template<typename StringView>
+static auto sortStrings(benchmark::State &state) -> void
+{
+    constexpr auto strings_count = std::size_t{100'000};
+
+    const auto strings =
+        makeSortInput(strings_count, static_cast<std::size_t>(state.range(0)));
+    const auto views = std::vector<StringView>(strings.begin(), strings.end());
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto sorted = views;
+        state.ResumeTiming();
+
+        std::ranges::sort(sorted);
+        benchmark::DoNotOptimize(sorted.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(strings_count));
+}
+
+// One range that contains nested ranges and quoted strings with brackets.
+static auto makeNestedRange(const std::size_t length) -> std::string
+{
+    auto engine = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int>{0, 31};
+    auto result = std::string{"("};
+
+    while (result.size() + 8 < length) {
+        switch (const auto value = distribution(engine)) {
+        case 0:
+            result.append("(ab)");
+            break;
+
+        case 1:
+            result.append(R"x("(\")")x");
+            break;
+
+        default:
+            result.push_back(static_cast<char>('a' + value % 26));
+            break;
+        }
+    }
+
+    result.push_back(')');
+    return result;
+}
+
+static auto scalarFindRangeEnd(benchmark::State &state) -> void
+{
+    const auto text = makeNestedRange(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto pairs_count = std::size_t{};
+
+        const auto it = std::ranges::find_if(text, [&pairs_count](const char chr) {
+            pairs_count += static_cast<std::size_t>(chr == '(');
+            pairs_count -= static_cast<std::size_t>(chr == ')');
+            return pairs_count == 0;
+        });
+
+        benchmark::DoNotOptimize(it);
+    }
+
+    setBytesProcessed(state);
+}
+
+static auto islFindRangeEnd(benchmark::State &state) -> void
+{
+    const auto text = makeNestedRange(static_cast<std::size_t>(state.range(0)));
+    const auto view = isl::string_view{text};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.findRangeEnd('(', ')'));
+    }
+
+    setBytesProcessed(state);
+}
+
+static auto islFindQuotedRangeEnd(benchmark::State &state) -> void
+{
+    const auto text = makeNestedRange(static_cast<std::size_t>(state.range(0)));
+    const auto view = isl::string_view{text};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.findQuotedRangeEnd('(', ')', '"', '\\'));
+    }
+
+    setBytesProcessed(state);
+}
+
+// CSV text with 8 fields of up to 16 characters per line. The text is built once, because
+// building it takes longer than splitting.
+static auto getCsv(const std::size_t length) -> const std::string &
+{
+    static auto csv = std::string{};
+
+    if (csv.size() >= length) {
+        return csv;
+    }
+
+    auto engine = std::mt19937{42};
+    auto length_distribution = std::uniform_int_distribution<std::size_t>{0, 16};
+    auto character_distribution = std::uniform_int_distribution<int>{'a', 'z'};
+
+    csv.clear();
+
+    while (csv.size() < length) {
+        for (std::size_t field = 0; field != 8; ++field) {
+            for (std::size_t i = length_distribution(engine); i != 0; --i) {
+                csv.push_back(static_cast<char>(character_distribution(engine)));
+            }
+
+            csv.push_back(field == 7 ? '\n' : ',');
+        }
+    }
+
+    return csv;
+}
+
+static auto stdGetlineCsv(benchmark::State &state) -> void
+{
+    const auto &csv = getCsv(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto stream = std::istringstream{csv};
+        auto fields = std::size_t{};
+
+        for (auto line = std::string{}; std::getline(stream, line);) {
+            auto line_stream = std::istringstream{line};
+
+            for (auto field = std::string{}; std::getline(line_stream, field, ',');) {
+                fields += field.size();
+            }
+        }
+
+        benchmark::DoNotOptimize(fields);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(csv.size()));
+}
+
+static auto stdViewsSplitCsv(benchmark::State &state) -> void
+{
+    const auto &csv = getCsv(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto fields = std::size_t{};
+
+        for (const auto line : std::views::split(std::string_view{csv}, '\n')) {
+            for (const auto field : std::views::split(line, ',')) {
+                fields += std::ranges::size(field);
+            }
+        }
+
+        benchmark::DoNotOptimize(fields);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(csv.size()));
+}
+
+static auto islSplitCsv(benchmark::State &state) -> void
+{
+    const auto &csv = getCsv(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto fields = std::size_t{};
+
+        for (const auto line : isl::string_view{csv}.lines()) {
+            for (const auto field : line.splitBy(',')) {
+                fields += field.size();
+            }
+        }
+
+        benchmark::DoNotOptimize(fields);
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(csv.size()));
+}
+
+// Cyrillic words with spaces, two bytes for most code points
+static auto makeUtf8Text(const std::size_t length) -> std::string
+{
+    auto engine = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int>{0, 32};
+    auto result = std::string{};
+
+    while (result.size() < length) {
+        const auto value = distribution(engine);
+
+        if (value == 0) {
+            result.push_back(' ');
+        } else {
+            isl::utf8::appendUtf32ToUtf8Container(
+                std::back_inserter(result), U'а' + static_cast<char32_t>(value - 1));
+        }
+    }
+
+    return result;
+}
+
+static auto islCodePointOffset(benchmark::State &state) -> void
+{
+    const auto text = makeUtf8Text(static_cast<std::size_t>(state.range(0)));
+    const auto view = isl::string_view{text};
+    const auto count = isl::utf8::countCodePoints(text);
+    auto index = std::size_t{};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.codePointOffset(index));
+        index = (index + 7919) % count;
+    }
+}
+
+static auto islCodePointIndexBuild(benchmark::State &state) -> void
+{
+    const auto text = makeUtf8Text(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(isl::CodePointIndex{isl::string_view{text}});
+    }
+
+    setBytesProcessed(state);
+}
+
+static auto islCodePointIndexOffset(benchmark::State &state) -> void
+{
+    const auto text = makeUtf8Text(static_cast<std::size_t>(state.range(0)));
+    const auto code_point_index = isl::CodePointIndex{isl::string_view{text}};
+    auto index = std::size_t{};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(code_point_index.offsetOf(index));
+        index = (index + 7919) % code_point_index.size();
+    }
+}
+
+BENCHMARK(stdStringViewFind)->RangeMultiplier(8)->Range(16, 64 << 10);
+BENCHMARK(rangesFind)->RangeMultiplier(8)->Range(16, 64 << 10);
+BENCHMARK(islStringViewFind)->RangeMultiplier(8)->Range(16, 64 << 10);
+BENCHMARK(stdStringViewFindFirstOf)->RangeMultiplier(8)->Range(16, 64 << 10);
+BENCHMARK(islStringViewFindFirstOf)->RangeMultiplier(8)->Range(16, 64 << 10);
+BENCHMARK(stdStringViewFindSubstring)->RangeMultiplier(8)->Range(16, 64 << 10);
+BENCHMARK(islStringViewFindSubstring)->RangeMultiplier(8)->Range(16, 64 << 10);
+BENCHMARK(islStringViewStrip)->RangeMultiplier(8)->Range(16, 64 << 10);
+
+// random strings and strings with 64 characters long shared prefix
+BENCHMARK(sortStrings<std::string_view>)->Arg(0)->Arg(64)->Unit(benchmark::kMillisecond);
+BENCHMARK(sortStrings<isl::string_view>)->Arg(0)->Arg(64)->Unit(benchmark::kMillisecond);
+
+BENCHMARK(scalarFindRangeEnd)->RangeMultiplier(8)->Range(4 << 10, 16 << 20);
+BENCHMARK(islFindRangeEnd)->RangeMultiplier(8)->Range(4 << 10, 16 << 20);
+BENCHMARK(islFindQuotedRangeEnd)->RangeMultiplier(8)->Range(4 << 10, 16 << 20);
+
+// splitting of 1 GB text runs at the same speed, but takes too long for a regular run
+BENCHMARK(stdGetlineCsv)->Arg(64 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(stdViewsSplitCsv)->Arg(64 << 20)->Unit(benchmark::kMillisecond);
+BENCHMARK(islSplitCsv)->Arg(64 << 20)->Unit(benchmark::kMillisecond);
+
+// random access by code point index
+BENCHMARK(islCodePointOffset)->RangeMultiplier(8)->Range(4 << 10, 16 << 20);
+BENCHMARK(islCodePointIndexBuild)->RangeMultiplier(8)->Range(4 << 10, 16 << 20);
+BENCHMARK(islCodePointIndexOffset)->RangeMultiplier(8)->Range(4 << 10, 16 << 20);
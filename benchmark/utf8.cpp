@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <isl/utf8.hpp>
+#include <random>
+#include <span>
+
+// Text of random code points below the limit with the given share of ASCII characters.
+static auto makeText(
+    const std::size_t length, const char32_t max_code_point, const int ascii_percent)
+    -> std::string
+{
+    auto engine = std::mt19937{42};
+    auto percent_distribution = std::uniform_int_distribution<int>{0, 99};
+    auto ascii_distribution = std::uniform_int_distribution<char32_t>{' ', '~'};
+    auto other_distribution = std::uniform_int_distribution<char32_t>{0x80, max_code_point};
+    auto result = std::string{};
+
+    while (result.size() < length) {
+        auto chr = ascii_distribution(engine);
+
+        if (percent_distribution(engine) >= ascii_percent) {
+            do {
+                chr = other_distribution(engine);
+            } while (chr >= 0xD800 && chr <= 0xDFFF);
+        }
+
+        isl::utf8::appendUtf32ToUtf8Container(std::back_inserter(result), chr);
+    }
+
+    return result;
+}
+
+static auto getText(const std::int64_t kind) -> const std::string &
+{
+    constexpr auto length = std::size_t{1} << 20U;
+
+    // ASCII, Cyrillic with spaces and punctuation, CJK, emoji
+    static const auto texts = std::array{
+        makeText(length, 0x7F, 100),
+        makeText(length, 0x4FF, 20),
+        makeText(length, 0x9FFF, 0),
+        makeText(length, 0x1F64F, 0),
+    };
+
+    return texts.at(static_cast<std::size_t>(kind));
+}
+
+static auto scalarValidateUtf8(benchmark::State &state) -> void
+{
+    const auto &text = getText(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            isl::utf8::detail::findFirstInvalidScalar(text.data(), 0, text.size()));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+static auto islValidateUtf8(benchmark::State &state) -> void
+{
+    const auto &text = getText(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(isl::utf8::findFirstInvalid(text));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+static auto rangesCountCodePoints(benchmark::State &state) -> void
+{
+    const auto &text = getText(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::ranges::count_if(text, [](const char chr) {
+            return !isl::utf8::isTrailingCharacter(chr);
+        }));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+static auto islCountCodePoints(benchmark::State &state) -> void
+{
+    const auto &text = getText(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(isl::utf8::countCodePoints(text));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+template<typename CharT>
+static auto scalarDecodeUtf8(benchmark::State &state) -> void
+{
+    const auto &text = getText(state.range(0));
+    auto buffer = std::vector<CharT>(text.size());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            isl::utf8::detail::decodeScalar(text.data(), text.size(), buffer.data()));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+template<typename CharT>
+static auto islDecodeUtf8(benchmark::State &state) -> void
+{
+    const auto &text = getText(state.range(0));
+    auto buffer = std::vector<CharT>(text.size());
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(isl::utf8::decode<isl::FunctionAPI::UNSAFE>(text, buffer));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+template<typename CharT>
+static auto scalarEncodeUtf8(benchmark::State &state) -> void
+{
+    const auto &text = getText(state.range(0));
+    auto decoded = std::vector<CharT>(text.size());
+    const auto decoded_size = isl::utf8::decode(text, decoded).size();
+    auto buffer = std::string(text.size(), '\0');
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            isl::utf8::detail::encodeScalar(decoded.data(), decoded_size, buffer.data()));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+template<typename CharT>
+static auto islEncodeUtf8(benchmark::State &state) -> void
+{
+    const auto &text = getText(state.range(0));
+    auto decoded = std::vector<CharT>(text.size());
+    const auto decoded_view = std::span<const CharT>{isl::utf8::decode(text, decoded)};
+    auto buffer = std::string(text.size(), '\0');
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            isl::utf8::encode<isl::FunctionAPI::UNSAFE>(decoded_view, buffer));
+        benchmark::ClobberMemory();
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+// argument selects text: ASCII, Cyrillic, CJK, emoji
+BENCHMARK(scalarValidateUtf8)->DenseRange(0, 3);
+BENCHMARK(islValidateUtf8)->DenseRange(0, 3);
+BENCHMARK(rangesCountCodePoints)->DenseRange(0, 3);
+BENCHMARK(islCountCodePoints)->DenseRange(0, 3);
+
+// bytes per second are counted in UTF-8
+BENCHMARK(scalarDecodeUtf8<char16_t>)->DenseRange(0, 3);
+BENCHMARK(islDecodeUtf8<char16_t>)->DenseRange(0, 3);
+BENCHMARK(scalarDecodeUtf8<char32_t>)->DenseRange(0, 3);
+BENCHMARK(islDecodeUtf8<char32_t>)->DenseRange(0, 3);
+BENCHMARK(scalarEncodeUtf8<char16_t>)->DenseRange(0, 3);
+BENCHMARK(islEncodeUtf8<char16_t>)->DenseRange(0, 3);
+BENCHMARK(scalarEncodeUtf8<char32_t>)->DenseRange(0, 3);
+BENCHMARK(islEncodeUtf8<char32_t>)->DenseRange(0, 3);
@@ -0,0 +1,260 @@
+#include <benchmark/benchmark.h>
+#include <isl/utf_set.hpp>
+#include <random>
+
+// Letter-like class: many short ranges in the BMP and a few long ones in supplementary planes
+static auto makeRanges() -> std::vector<isl::Range<char32_t>>
+{
+    auto engine = std::mt19937{42};
+    auto gap_distribution = std::uniform_int_distribution<char32_t>{1, 96};
+    auto length_distribution = std::uniform_int_distribution<char32_t>{1, 64};
+    auto ranges = std::vector<isl::Range<char32_t>>{};
+
+    for (char32_t chr = 0xC0; chr < 0xFFFF;) {
+        const auto length = length_distribution(engine);
+        ranges.emplace_back(chr, chr + length);
+        chr += length + gap_distribution(engine);
+    }
+
+    ranges.emplace_back(0x20000, 0x2A6E0);
+    ranges.emplace_back(0x30000, 0x3134B);
+
+    return ranges;
+}
+
+static auto makeQueries() -> std::vector<char32_t>
+{
+    auto engine = std::mt19937{7};
+    auto distribution = std::uniform_int_distribution<char32_t>{0x80, 0xFFFF};
+    auto queries = std::vector<char32_t>(4096);
+
+    for (auto &chr : queries) {
+        chr = distribution(engine);
+    }
+
+    return queries;
+}
+
+static auto hashSetLookup(benchmark::State &state) -> void
+{
+    auto set = ankerl::unordered_dense::set<char32_t>{};
+
+    for (const auto range : makeRanges()) {
+        for (const char32_t chr : range) {
+            set.insert(chr);
+        }
+    }
+
+    const auto queries = makeQueries();
+
+    for (auto _ : state) {
+        auto found = std::size_t{};
+
+        for (const char32_t chr : queries) {
+            found += static_cast<std::size_t>(set.contains(chr));
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+}
+
+static auto utfSetLookup(benchmark::State &state) -> void
+{
+    const auto utf_set = isl::UtfSet{{}, makeRanges()};
+    const auto queries = makeQueries();
+
+    for (auto _ : state) {
+        auto found = std::size_t{};
+
+        for (const char32_t chr : queries) {
+            found += static_cast<std::size_t>(utf_set.at(chr));
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+}
+
+static auto utfSetBuild(benchmark::State &state) -> void
+{
+    const auto ranges = makeRanges();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(isl::UtfSet{{}, ranges});
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(ranges.size()));
+}
+
+static auto makeIdentifierSet() -> isl::UtfSet
+{
+    auto utf_set = isl::UtfSet{{}, makeRanges()};
+
+    utf_set.set({'a', 'z' + 1});
+    utf_set.set({'A', 'Z' + 1});
+    utf_set.set({'0', '9' + 1});
+    utf_set.set('_');
+    utf_set.set(U'é');
+
+    return utf_set;
+}
+
+// Source code like text: long identifiers with a few non-ASCII letters and separators
+static auto makeIdentifiers() -> std::string
+{
+    auto engine = std::mt19937{3};
+    auto distribution = std::uniform_int_distribution<int>{0, 63};
+    auto text = std::string{};
+
+    while (text.size() < 4096) {
+        const auto kind = distribution(engine);
+
+        if (kind == 0) {
+            text += "\xC3\xA9";
+        } else {
+            text.push_back(static_cast<char>('a' + kind % 26));
+        }
+    }
+
+    return text;
+}
+
+static auto utfSetClassify(benchmark::State &state) -> void
+{
+    const auto utf_set = makeIdentifierSet();
+    const auto text = makeIdentifiers();
+    const auto chars = std::vector<char32_t>{text.begin(), text.end()};
+    auto bits = std::vector<isl::u64>((chars.size() + 63) / 64);
+
+    for (auto _ : state) {
+        utf_set.classify(chars, bits);
+        benchmark::DoNotOptimize(bits.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(chars.size()));
+}
+
+static auto utfSetClassifyScalar(benchmark::State &state) -> void
+{
+    const auto utf_set = makeIdentifierSet();
+    const auto text = makeIdentifiers();
+    const auto chars = std::vector<char32_t>{text.begin(), text.end()};
+    auto bits = std::vector<isl::u64>((chars.size() + 63) / 64);
+
+    for (auto _ : state) {
+        std::ranges::fill(bits, 0);
+
+        for (std::size_t i = 0; i != chars.size(); ++i) {
+            bits[i / 64] |= static_cast<isl::u64>(utf_set.at(chars[i])) << (i % 64);
+        }
+
+        benchmark::DoNotOptimize(bits.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(chars.size()));
+}
+
+static auto utfSetSpanWhile(benchmark::State &state) -> void
+{
+    const auto utf_set = makeIdentifierSet();
+    const auto text = makeIdentifiers();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(utf_set.spanWhile(text));
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+static auto utfSetSpanWhileScalar(benchmark::State &state) -> void
+{
+    const auto utf_set = makeIdentifierSet();
+    const auto text = makeIdentifiers();
+
+    for (auto _ : state) {
+        const auto code_points = isl::string_view{text}.codepoints();
+        auto it = code_points.begin();
+
+        while (it != code_points.end() && utf_set.at(*it)) {
+            ++it;
+        }
+
+        benchmark::DoNotOptimize(it.base());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+
+using CodePoints = isl::Range<char32_t>;
+
+// Letters of a few scripts, a typical class of identifier characters
+static constexpr auto ScriptLetters = isl::StaticUtfSet{{
+    CodePoints{'a', 'z' + 1},     CodePoints{'A', 'Z' + 1},     CodePoints{'_', '_' + 1},
+    CodePoints{0xC0, 0xD7},       CodePoints{0xD8, 0xF7},       CodePoints{0xF8, 0x250},
+    CodePoints{0x370, 0x374},     CodePoints{0x386, 0x387},     CodePoints{0x388, 0x3FF},
+    CodePoints{0x400, 0x482},     CodePoints{0x48A, 0x530},     CodePoints{0x531, 0x557},
+    CodePoints{0x5D0, 0x5EB},     CodePoints{0x620, 0x64B},     CodePoints{0x904, 0x93A},
+    CodePoints{0x3041, 0x3097},   CodePoints{0x30A1, 0x30FB},   CodePoints{0x4E00, 0xA000},
+    CodePoints{0xAC00, 0xD7A4},   CodePoints{0x20000, 0x2A6E0},
+}};
+
+template<isl::StaticUtfSet Set>
+static auto countInSet(const std::vector<char32_t> &queries) -> std::size_t
+{
+    auto found = std::size_t{};
+
+    for (const char32_t chr : queries) {
+        found += static_cast<std::size_t>(Set.at(chr));
+    }
+
+    return found;
+}
+
+static auto staticUtfSetLookup(benchmark::State &state) -> void
+{
+    const auto queries = makeQueries();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(countInSet<ScriptLetters>(queries));
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+}
+
+static auto dynamicUtfSetLookup(benchmark::State &state) -> void
+{
+    const auto &boundaries = ScriptLetters.nonAsciiBoundaries;
+    auto ranges = std::vector<CodePoints>{{'a', 'z' + 1}, {'A', 'Z' + 1}, {'_', '_' + 1}};
+
+    for (std::size_t i = 0; i != ScriptLetters.boundariesCount; i += 2) {
+        ranges.emplace_back(boundaries[i], boundaries[i + 1]);
+    }
+
+    const auto utf_set = isl::UtfSet{{}, ranges};
+    const auto queries = makeQueries();
+
+    for (auto _ : state) {
+        auto found = std::size_t{};
+
+        for (const char32_t chr : queries) {
+            found += static_cast<std::size_t>(utf_set.at(chr));
+        }
+
+        benchmark::DoNotOptimize(found);
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(queries.size()));
+}
+
+BENCHMARK(hashSetLookup);
+BENCHMARK(utfSetLookup);
+BENCHMARK(utfSetBuild);
+BENCHMARK(utfSetClassify);
+BENCHMARK(utfSetClassifyScalar);
+BENCHMARK(utfSetSpanWhile);
+BENCHMARK(utfSetSpanWhileScalar);
+BENCHMARK(staticUtfSetLookup);
+BENCHMARK(dynamicUtfSetLookup);
@@ -0,0 +1,99 @@
+#include <isl/atomic_shared_ptr.hpp>
+#include <isl/detail/debug/debug.hpp>
+#include <thread>
+
+struct Config
+{
+    std::size_t version;
+    std::size_t checksum;
+};
+
+using ConfigFrame = isl::SharedPtrFrameFor<Config>;
+
+// NOLINTNEXTLINE
+static constinit auto ConfigAllocator =
+    isl::PoolAllocator<sizeof(ConfigFrame), alignof(ConfigFrame)>{};
+
+using ConfigPtr = isl::SharedPtr<Config, ConfigFrame, &ConfigAllocator>;
+using AtomicConfigPtr = isl::AtomicSharedPtr<Config, ConfigFrame, &ConfigAllocator>;
+
+TEST_CASE("AtomicSharedPtrLoadStore", "[AtomicSharedPtr]")
+{
+    auto slot = AtomicConfigPtr{};
+
+    REQUIRE(slot.load() == nullptr);
+    REQUIRE_FALSE(slot.read());
+
+    slot.store(ConfigPtr{Config{.version = 1, .checksum = 10}});
+
+    const auto first = slot.load();
+    REQUIRE(first->version == 1);
+    REQUIRE(slot.read()->checksum == 10);
+
+    const auto previous = slot.exchange(ConfigPtr{Config{.version = 2, .checksum = 20}});
+    REQUIRE(previous.get() == first.get());
+    REQUIRE(slot.load()->version == 2);
+}
+
+TEST_CASE("AtomicSharedPtrSnapshotOutlivesStore", "[AtomicSharedPtr]")
+{
+    auto slot = AtomicConfigPtr{ConfigPtr{Config{.version = 1, .checksum = 10}}};
+
+    const auto snapshot = slot.read();
+    slot.store(ConfigPtr{Config{.version = 2, .checksum = 20}});
+    slot.store(ConfigPtr{Config{.version = 3, .checksum = 30}});
+
+    REQUIRE(snapshot->version == 1);
+    REQUIRE(snapshot->checksum == 10);
+    REQUIRE(slot.read()->version == 3);
+}
+
+TEST_CASE("AtomicSharedPtrConcurrentReaders", "[AtomicSharedPtr]")
+{
+    static constexpr std::size_t readers_count = 4;
+    static constexpr std::size_t updates_count = 1'000;
+
+    auto slot = AtomicConfigPtr{ConfigPtr{Config{.version = 0, .checksum = 0}}};
+    auto finished = std::atomic<bool>{false};
+    auto readers = std::vector<std::thread>{};
+    auto torn_reads = std::atomic<std::size_t>{};
+
+    for (std::size_t i = 0; i != readers_count; ++i) {
+        readers.emplace_back([&slot, &finished, &torn_reads]() {
+            auto last_version = std::size_t{};
+
+            while (!finished.load(std::memory_order_acquire)) {
+                const auto snapshot = slot.read();
+                const auto *config = snapshot.get();
+
+                // assertions are not thread-safe, failures are checked after join
+                if (config == nullptr) {
+                    torn_reads.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (config->checksum != config->version * 10 || config->version < last_version) {
+                    torn_reads.fetch_add(1, std::memory_order_relaxed);
+                }
+
+                last_version = config->version;
+            }
+        });
+    }
+
+    // the pool allocator is not thread-safe, so only this thread allocates and frees
+    for (std::size_t version = 1; version != updates_count; ++version) {
+        slot.store(ConfigPtr{Config{.version = version, .checksum = version * 10}});
+    }
+
+    finished.store(true, std::memory_order_release);
+
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    slot.collectRetired();
+
+    REQUIRE(torn_reads == 0);
+    REQUIRE(slot.read()->version == updates_count - 1);
+}
@@ -0,0 +1,36 @@
+#ifndef ISL_PROJECT_KERNEL_SETS_HPP
+#define ISL_PROJECT_KERNEL_SETS_HPP
+
+#include <isl/detail/string_search.hpp>
+#include <isl/detail/unicode.hpp>
+
+// Runs the check with every kernel set supported by the build and the CPU, so machines with
+// AVX2 test SSE2 and scalar kernels too. String search and UTF-8 kernels are switched together.
+template<typename Check>
+auto forEachKernelSet(const Check &check) -> void
+{
+    using isl::detail::KernelSet;
+
+    struct DetectedKernelsGuard
+    {
+        DetectedKernelsGuard() = default;
+        DetectedKernelsGuard(const DetectedKernelsGuard &) = delete;
+        auto operator=(const DetectedKernelsGuard &) -> DetectedKernelsGuard & = delete;
+
+        ~DetectedKernelsGuard()
+        {
+            static_cast<void>(isl::detail::string_search::selectKernels(KernelSet::DETECTED));
+            static_cast<void>(isl::detail::unicode::selectKernels(KernelSet::DETECTED));
+        }
+    } guard;
+
+    for (const auto kernel_set :
+         {KernelSet::AVX2, KernelSet::SSE2, KernelSet::NEON, KernelSet::SCALAR}) {
+        if (isl::detail::string_search::selectKernels(kernel_set)
+            && isl::detail::unicode::selectKernels(kernel_set)) {
+            check();
+        }
+    }
+}
+
+#endif /* ISL_PROJECT_KERNEL_SETS_HPP */
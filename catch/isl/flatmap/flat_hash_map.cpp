@@ -0,0 +1,213 @@
+#include <isl/detail/debug/debug.hpp>
+#include <isl/flat_hash_map.hpp>
+#include <random>
+
+TEST_CASE("FlatHashMapBasic", "[FlatHashMap]")
+{
+    // NOLINTBEGIN
+
+    auto map = isl::FlatHashMap<int, int>{{30, 40}, {10, 20}, {20, 30}};
+
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.at(10) == 20);
+    REQUIRE(map[20] == 30);
+    REQUIRE(map.contains(30));
+    REQUIRE_FALSE(map.contains(25));
+    REQUIRE_THROWS_AS(map.at(25), std::out_of_range);
+
+    map[25] = 1;
+    REQUIRE_FALSE(map.insertOrAssign(10, 5).second);
+    REQUIRE(map.at(10) == 5);
+    REQUIRE(map.size() == 4);
+
+    REQUIRE(map.erase(25) == 1);
+    REQUIRE(map.erase(25) == 0);
+    REQUIRE(map.find(25) == map.end());
+
+    auto sum = 0;
+
+    for (const auto &[key, value] : map) {
+        sum += key;
+    }
+
+    REQUIRE(sum == 60);
+
+    // NOLINTEND
+}
+
+TEST_CASE("FlatHashMapEmpty", "[FlatHashMap]")
+{
+    auto map = isl::FlatHashMap<int, int>{};
+
+    REQUIRE(map.empty());
+    REQUIRE(map.begin() == map.end());
+    REQUIRE_FALSE(map.contains(0));
+    REQUIRE(map.erase(0) == 0);
+
+    map.clear();
+    REQUIRE(map.capacity() == 0);
+}
+
+TEST_CASE("FlatHashMapMatchesStdMap", "[FlatHashMap]")
+{
+    auto engine = std::mt19937{42};// NOLINT
+    auto distribution = std::uniform_int_distribution<int>{0, 5000};
+
+    auto map = isl::FlatHashMap<int, std::string>{};
+    auto expected = std::map<int, std::string>{};
+
+    for (int i = 0; i != 50'000; ++i) {
+        const auto key = distribution(engine);
+
+        if (i % 3 == 0) {
+            REQUIRE(map.erase(key) == expected.erase(key));
+        } else {
+            const auto value = std::to_string(i);
+            REQUIRE(map.tryEmplace(key, value).second == expected.try_emplace(key, value).second);
+        }
+    }
+
+    REQUIRE(map.size() == expected.size());
+    REQUIRE(static_cast<std::size_t>(std::distance(map.begin(), map.end())) == map.size());
+
+    for (const auto &[key, value] : expected) {
+        REQUIRE(map.at(key) == value);
+    }
+
+    auto copy = map;
+    map.clear();
+
+    REQUIRE(map.empty());
+    REQUIRE(copy.size() == expected.size());
+
+    map = std::move(copy);
+    REQUIRE(map.size() == expected.size());
+}
+
+TEST_CASE("FlatHashMapHeterogeneousLookup", "[FlatHashMap]")
+{
+    using namespace isl::string_view_literals;
+
+    auto map = isl::FlatHashMap<std::string, int>{{"while", 1}, {"for", 2}, {"if", 3}};
+
+    REQUIRE(map.contains("for"_sv));
+    REQUIRE(map.at("if"_sv) == 3);
+    REQUIRE(map.find("else"_sv) == map.end());
+
+    map.tryEmplace("else"_sv, 4);
+    REQUIRE(map.at(std::string_view{"else"}) == 4);
+    REQUIRE(map.erase("while"_sv) == 1);
+}
+
+// Keys are equal by the modulus, a default constructed modulus compares keys exactly.
+struct ModuloHash
+{
+    std::uint64_t modulus{};
+
+    auto operator()(const std::uint64_t key) const noexcept -> std::uint64_t
+    {
+        const auto reduced = modulus == 0 ? key : key % modulus;
+        return reduced * 0x9E37'79B9'7F4A'7C15ULL;
+    }
+};
+
+struct ModuloEqual
+{
+    std::uint64_t modulus{};
+
+    auto operator()(const std::uint64_t lhs, const std::uint64_t rhs) const noexcept -> bool
+    {
+        return modulus == 0 ? lhs == rhs : lhs % modulus == rhs % modulus;
+    }
+};
+
+TEST_CASE("FlatHashMapStatefulHashKeepsStateOnGrowth", "[FlatHashMap]")
+{
+    static constexpr std::uint64_t modulus = 1'000;
+
+    auto map = isl::FlatHashMap<std::uint64_t, std::uint64_t, ModuloHash, ModuloEqual>{
+        ModuloHash{modulus}, ModuloEqual{modulus}};
+
+    for (std::uint64_t i = 0; i != 500; ++i) {
+        map.tryEmplace(i, i);
+    }
+
+    for (std::uint64_t i = 0; i != 500; ++i) {
+        REQUIRE(map.contains(i + modulus));
+        REQUIRE(map.at(i + 2 * modulus) == i);
+    }
+
+    REQUIRE_FALSE(map.tryEmplace(modulus, 0).second);
+    REQUIRE(map.size() == 500);
+}
+
+// Value which counts living objects, copies of a value marked as throwing fail.
+struct CountedValue
+{
+    static inline int liveCount = 0;
+
+    int value{};
+    bool throwsOnCopy{};
+
+    explicit CountedValue(const int number, const bool throws_on_copy = false)
+      : value{number}
+      , throwsOnCopy{throws_on_copy}
+    {
+        ++liveCount;
+    }
+
+    CountedValue(const CountedValue &other)
+      : value{other.value}
+    {
+        if (other.throwsOnCopy) {
+            throw std::invalid_argument{"copy of a throwing value"};
+        }
+
+        ++liveCount;
+    }
+
+    CountedValue(CountedValue &&other) noexcept
+      : value{other.value}
+    {
+        ++liveCount;
+    }
+
+    auto operator=(const CountedValue &other) -> CountedValue & = default;
+    auto operator=(CountedValue &&other) noexcept -> CountedValue & = default;
+
+    ~CountedValue()
+    {
+        --liveCount;
+    }
+};
+
+TEST_CASE("FlatHashMapThrowingValueLeavesMapUnchanged", "[FlatHashMap]")
+{
+    {
+        auto map = isl::FlatHashMap<int, CountedValue>{};
+        const auto throwing = CountedValue{-1, true};
+
+        for (int i = 0; i != 100; ++i) {
+            map.tryEmplace(i, i);
+        }
+
+        REQUIRE_THROWS_AS(map.tryEmplace(100, throwing), std::invalid_argument);
+        REQUIRE_THROWS_AS(map.insertOrAssign(101, throwing), std::invalid_argument);
+
+        REQUIRE(map.size() == 100);
+        REQUIRE_FALSE(map.contains(100));
+        REQUIRE_FALSE(map.contains(101));
+        REQUIRE(CountedValue::liveCount == 101);
+
+        for (int i = 100; i != 200; ++i) {
+            map.tryEmplace(i, i);
+        }
+
+        REQUIRE(map.size() == 200);
+        REQUIRE(map.at(150).value == 150);
+        REQUIRE(map.erase(100) == 1);
+        REQUIRE(CountedValue::liveCount == 200);
+    }
+
+    REQUIRE(CountedValue::liveCount == 0);
+}
@@ -0,0 +1,107 @@
+#include <isl/detail/debug/debug.hpp>
+#include <isl/flat_map.hpp>
+#include <isl/string_view.hpp>
+#include <random>
+
+TEST_CASE("FlatMapBasic", "[FlatMap]")
+{
+    // NOLINTBEGIN
+
+    auto map = isl::FlatMap<int, int>{{30, 40}, {10, 20}, {20, 30}, {10, 0}};
+
+    REQUIRE(map.size() == 3);
+    REQUIRE(std::ranges::is_sorted(map, {}, [](const auto &value) {
+        return value.first;
+    }));
+
+    REQUIRE(map.at(10) == 20);
+    REQUIRE(map[20] == 30);
+    REQUIRE(map.contains(30));
+    REQUIRE_FALSE(map.contains(25));
+    REQUIRE_THROWS_AS(map.at(25), std::out_of_range);
+
+    map[25] = 1;
+    REQUIRE(map.insertOrAssign(10, 5).second == false);
+    REQUIRE(map.tryEmplace(5, 6).second);
+    REQUIRE_FALSE(map.tryEmplace(5, 7).second);
+
+    REQUIRE(map.size() == 5);
+    REQUIRE(map.at(10) == 5);
+    REQUIRE(map.at(5) == 6);
+    REQUIRE(map.begin()->first == 5);
+
+    REQUIRE(map.erase(25) == 1);
+    REQUIRE(map.erase(25) == 0);
+    REQUIRE(map.find(25) == map.end());
+
+    // NOLINTEND
+}
+
+TEST_CASE("FlatMapMatchesStdMap", "[FlatMap]")
+{
+    auto engine = std::mt19937{42};// NOLINT
+    auto distribution = std::uniform_int_distribution<int>{-1000, 1000};
+
+    auto map = isl::FlatMap<int, int>{};
+    auto expected = std::map<int, int>{};
+
+    for (int i = 0; i != 2000; ++i) {
+        const auto key = distribution(engine);
+
+        if (i % 3 == 0) {
+            REQUIRE(map.erase(key) == expected.erase(key));
+        } else {
+            REQUIRE(map.tryEmplace(key, i).second == expected.try_emplace(key, i).second);
+        }
+    }
+
+    REQUIRE(std::ranges::equal(map, expected, [](const auto &lhs, const auto &rhs) {
+        return lhs.first == rhs.first && lhs.second == rhs.second;
+    }));
+
+    for (int key = -1001; key != 1002; ++key) {
+        REQUIRE(map.contains(key) == expected.contains(key));
+
+        const auto lower_bound = expected.lower_bound(key);
+        const auto it = map.lowerBound(key);
+
+        REQUIRE((it == map.end()) == (lower_bound == expected.end()));
+
+        if (it != map.end()) {
+            REQUIRE(it->first == lower_bound->first);
+        }
+    }
+}
+
+TEST_CASE("FlatMapInsertUntilSentinel", "[FlatMap]")
+{
+    const auto pairs = std::vector<isl::Pair<int, int>>{{3, 30}, {1, 10}, {2, 20}, {0, 0}};
+    const auto till_zero = std::views::take_while(pairs, [](const auto &pair) {
+        return pair.first != 0;
+    });
+
+    STATIC_REQUIRE_FALSE(std::ranges::common_range<decltype(till_zero)>);
+
+    auto map = isl::FlatMap<int, int>{till_zero.begin(), till_zero.end()};
+    REQUIRE(map.size() == 3);
+    REQUIRE(map.at(1) == 10);
+    REQUIRE_FALSE(map.contains(0));
+
+    map.insert(std::counted_iterator{pairs.begin() + 3, 1}, std::default_sentinel);
+    REQUIRE(map.size() == 4);
+    REQUIRE(map.at(0) == 0);
+}
+
+TEST_CASE("FlatMapHeterogeneousLookup", "[FlatMap]")
+{
+    using namespace isl::string_view_literals;
+
+    auto map = isl::FlatMap<std::string, int>{{"while", 1}, {"for", 2}, {"if", 3}};
+
+    REQUIRE(map.contains("for"_sv));
+    REQUIRE(map.at("if"_sv) == 3);
+    REQUIRE(map.find("else"_sv) == map.end());
+
+    map.tryEmplace("else"_sv, 4);
+    REQUIRE(map.at(std::string_view{"else"}) == 4);
+}
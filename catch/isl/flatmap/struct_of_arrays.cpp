@@ -0,0 +1,83 @@
+#include <isl/detail/debug/debug.hpp>
+#include <isl/static_flat_map.hpp>
+
+// NOLINTBEGIN
+
+enum struct Opcode : isl::u16
+{
+    ADD = 1,
+    SUB = 7,
+    MUL = 300,
+    DIV = 4000,
+};
+
+template<typename Key>
+static auto checkSoaLookup() -> void
+{
+    static constexpr std::size_t size = 80;
+
+    auto flatmap = isl::StaticSoaFlatmap<Key, int, size>{};
+    auto keys = std::vector<Key>{};
+
+    for (std::size_t i = 0; i != size; ++i) {
+        const auto key = static_cast<Key>(i * 3 + 1);
+
+        keys.emplace_back(key);
+        REQUIRE(flatmap.tryEmplace(key, static_cast<int>(i)).second);
+    }
+
+    for (std::size_t i = 0; i != size; ++i) {
+        REQUIRE(flatmap.at(keys[i]) == static_cast<int>(i));
+        REQUIRE_FALSE(flatmap.contains(static_cast<Key>(i * 3 + 2)));
+    }
+
+    REQUIRE(flatmap.find(static_cast<Key>(0)) == flatmap.end());
+}
+
+TEST_CASE("FlatmapSoaLookup", "[Flatmap]")
+{
+    checkSoaLookup<isl::u8>();
+    checkSoaLookup<isl::i16>();
+    checkSoaLookup<isl::u32>();
+    checkSoaLookup<isl::i64>();
+}
+
+TEST_CASE("FlatmapSoaEnumKeys", "[Flatmap]")
+{
+    static constexpr auto flatmap = isl::StaticSoaFlatmap<Opcode, char, 10>{
+        {Opcode::ADD, '+'},
+        {Opcode::SUB, '-'},
+        {Opcode::MUL, '*'},
+        {Opcode::DIV, '/'},
+    };
+
+    static_assert(flatmap.at(Opcode::MUL) == '*');
+    static_assert(!flatmap.contains(static_cast<Opcode>(2)));
+
+    REQUIRE(flatmap.at(Opcode::ADD) == '+');
+    REQUIRE(flatmap.at(Opcode::DIV) == '/');
+    REQUIRE(flatmap.find(Opcode::SUB)->second == '-');
+    REQUIRE_THROWS_AS(flatmap.at(static_cast<Opcode>(2)), std::out_of_range);
+}
+
+TEST_CASE("FlatmapSoaIteration", "[Flatmap]")
+{
+    auto flatmap = isl::StaticSoaFlatmap<int, int, 10>{{10, 20}, {20, 30}, {30, 40}};
+
+    flatmap[40] = 50;
+    flatmap[20] = 35;
+
+    auto keys_sum = 0;
+
+    for (auto [key, value] : flatmap) {
+        keys_sum += key;
+        value += 1;
+    }
+
+    REQUIRE(keys_sum == 100);
+    REQUIRE(flatmap.size() == 4);
+    REQUIRE(flatmap.at(20) == 36);
+    REQUIRE(flatmap.at(40) == 51);
+}
+
+// NOLINTEND
@@ -0,0 +1,101 @@
+#include <isl/detail/debug/debug.hpp>
+#include <isl/object_pool.hpp>
+#include <thread>
+
+struct ClearString
+{
+    auto operator()(std::string &str) const noexcept -> void
+    {
+        str.clear();
+    }
+};
+
+using StringObjectPool = isl::ObjectPool<std::string, ClearString>;
+
+// NOLINTNEXTLINE
+static auto GlobalStringObjectPool = StringObjectPool{};
+
+TEST_CASE("ObjectPoolReusesObjects", "[ObjectPool]")
+{
+    auto pool = StringObjectPool{};
+    auto *address = static_cast<std::string *>(nullptr);
+
+    {
+        auto lease = pool.acquire();
+        lease->assign(64, 'a');
+        address = lease.get();
+    }
+
+    const auto lease = pool.acquire();
+
+    REQUIRE(lease.get() == address);
+    REQUIRE(lease->empty());
+    REQUIRE(lease->capacity() >= 64);
+    REQUIRE(pool.getCreatedObjectsCount() == 1);
+}
+
+TEST_CASE("ObjectPoolUniquePtr", "[ObjectPool]")
+{
+    auto pool = StringObjectPool{};
+    auto ptr = pool.acquireUnique();
+    auto *address = ptr.get();
+
+    *ptr = "Hello, World!";
+    ptr = nullptr;
+
+    const auto reused = pool.acquireUnique();
+    REQUIRE(reused.get() == address);
+    REQUIRE(reused->empty());
+}
+
+TEST_CASE("ObjectPoolStaticUniquePtr", "[ObjectPool]")
+{
+    using Ptr = isl::UniquePtr<std::string, &GlobalStringObjectPool>;
+
+    STATIC_REQUIRE(sizeof(Ptr) == sizeof(std::string *));
+
+    auto ptr = Ptr::createDefault();
+    auto *address = ptr.get();
+    *ptr = "Hello, World!";
+    ptr = nullptr;
+
+    const auto reused = Ptr::createDefault();
+    REQUIRE(reused.get() == address);
+    REQUIRE(reused->empty());
+}
+
+TEST_CASE("ObjectPoolRuntimeUniquePtrRejectsArguments", "[ObjectPool]")
+{
+    using Ptr = isl::UniquePtr<std::string, &isl::RuntimeAllocator>;
+
+    auto pool = StringObjectPool{};
+
+    REQUIRE_THROWS_AS(Ptr(std::allocator_arg, pool, "ignored"), std::invalid_argument);
+    REQUIRE(pool.getCreatedObjectsCount() == 0);
+
+    const auto ptr = Ptr{std::allocator_arg, pool};
+    REQUIRE(ptr->empty());
+    REQUIRE(pool.getCreatedObjectsCount() == 1);
+}
+
+TEST_CASE("ObjectPoolSharedBetweenThreads", "[ObjectPool]")
+{
+    auto pool = isl::ObjectPool<std::vector<int>>{{}, 4};
+    auto threads = std::vector<std::thread>{};
+
+    for (std::size_t i = 0; i != 4; ++i) {
+        threads.emplace_back([&pool]() {
+            for (int j = 0; j != 1'000; ++j) {
+                auto lease = pool.acquire();
+                lease->push_back(j);
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    // objects are created only when no cache has a free one
+    REQUIRE(pool.getCreatedObjectsCount() < 4'000);
+}
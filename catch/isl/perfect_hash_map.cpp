@@ -0,0 +1,99 @@
+#include <isl/detail/debug/debug.hpp>
+#include <isl/perfect_hash_map.hpp>
+
+// NOLINTBEGIN
+
+using namespace isl::string_view_literals;
+
+enum struct Token : isl::u8
+{
+    IF,
+    ELSE,
+    WHILE,
+    FOR,
+    RETURN,
+};
+
+TEST_CASE("PerfectHashMapStringKeys", "[PerfectHashMap]")
+{
+    static constexpr auto keywords = isl::makePerfectHashMap<isl::string_view, Token>({
+        {"if"_sv, Token::IF},
+        {"else"_sv, Token::ELSE},
+        {"while"_sv, Token::WHILE},
+        {"for"_sv, Token::FOR},
+        {"return"_sv, Token::RETURN},
+    });
+
+    static_assert(keywords.size() == 5);
+    static_assert(keywords.at("while"_sv) == Token::WHILE);
+    static_assert(!keywords.contains("whilst"_sv));
+
+    REQUIRE(keywords.at("if") == Token::IF);
+    REQUIRE(keywords["return"] == Token::RETURN);
+    REQUIRE(keywords.find("for")->second == Token::FOR);
+
+    REQUIRE_FALSE(keywords.contains(""));
+    REQUIRE_FALSE(keywords.contains("iff"));
+    REQUIRE(keywords.find("el") == keywords.end());
+    REQUIRE_THROWS_AS(keywords.at("do"), std::out_of_range);
+}
+
+TEST_CASE("PerfectHashMapIntegerKeys", "[PerfectHashMap]")
+{
+    static constexpr auto squares = []() consteval {
+        using Map = isl::PerfectHashMap<isl::u64, isl::u64, 300>;
+        auto data = std::array<Map::value_type, 300>{};
+
+        for (isl::u64 i = 0; i != data.size(); ++i) {
+            data[i] = Map::value_type{i * 7, i * i};
+        }
+
+        return Map{data};
+    }();
+
+    static_assert(squares.at(7 * 299) == 299 * 299);
+
+    for (isl::u64 i = 0; i != 300 * 7; ++i) {
+        REQUIRE(squares.contains(i) == (i % 7 == 0));
+
+        if (i % 7 == 0) {
+            REQUIRE(squares.at(i) == (i / 7) * (i / 7));
+        }
+    }
+
+    REQUIRE(std::ranges::distance(squares) == 300);
+}
+
+TEST_CASE("PerfectHashMapPowerOfTwoSize", "[PerfectHashMap]")
+{
+    static constexpr auto cubes = []() consteval {
+        using Map = isl::PerfectHashMap<isl::u64, isl::u64, 1024>;
+        auto data = std::array<Map::value_type, 1024>{};
+
+        for (isl::u64 i = 0; i != data.size(); ++i) {
+            data[i] = Map::value_type{i * 3, i * i * i};
+        }
+
+        return Map{data};
+    }();
+
+    static_assert(cubes.at(3 * 1023) == 1023 * 1023 * 1023);
+
+    for (isl::u64 i = 0; i != 1024 * 3; ++i) {
+        REQUIRE(cubes.contains(i) == (i % 3 == 0));
+
+        if (i % 3 == 0) {
+            REQUIRE(cubes.at(i) == (i / 3) * (i / 3) * (i / 3));
+        }
+    }
+}
+
+TEST_CASE("PerfectHashMapSingleKey", "[PerfectHashMap]")
+{
+    static constexpr auto map = isl::PerfectHashMap<int, int, 1>{{10, 20}};
+
+    REQUIRE(map.at(10) == 20);
+    REQUIRE_FALSE(map.contains(0));
+}
+
+// NOLINTEND
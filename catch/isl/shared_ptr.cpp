@@ -0,0 +1,251 @@
+#include <isl/detail/debug/debug.hpp>
+#include <isl/memory.hpp>
+#include <latch>
+#include <thread>
+
+struct DestructionCounter
+{
+    std::atomic<std::size_t> *counter;
+
+    explicit DestructionCounter(std::atomic<std::size_t> *destruction_counter)
+      : counter{destruction_counter}
+    {}
+
+    DestructionCounter(const DestructionCounter &) = delete;
+    DestructionCounter(DestructionCounter &&) = delete;
+
+    ~DestructionCounter()
+    {
+        counter->fetch_add(1, std::memory_order_relaxed);
+    }
+
+    auto operator=(const DestructionCounter &) -> DestructionCounter & = delete;
+    auto operator=(DestructionCounter &&) -> DestructionCounter & = delete;
+};
+
+template <isl::RefCountPolicy Policy>
+using FrameWithPolicy = isl::SharedPtrFrameWithPolicyFor<Policy, DestructionCounter>;
+
+template <isl::RefCountPolicy Policy>
+// NOLINTNEXTLINE
+constinit auto FrameAllocator =
+    isl::PoolAllocator<sizeof(FrameWithPolicy<Policy>), alignof(FrameWithPolicy<Policy>)>{};
+
+template <isl::RefCountPolicy Policy>
+using CountedPtr =
+    isl::SharedPtr<DestructionCounter, FrameWithPolicy<Policy>, &FrameAllocator<Policy>>;
+
+template <isl::RefCountPolicy Policy>
+static auto testSingleThreadLifetime() -> void
+{
+    auto destroyed = std::atomic<std::size_t>{};
+
+    {
+        auto ptr = CountedPtr<Policy>{&destroyed};
+        auto copy = ptr;
+
+        {
+            const auto another_copy = copy;
+            REQUIRE(another_copy.get() == ptr.get());
+        }
+
+        ptr = nullptr;
+        REQUIRE(destroyed == 0);
+    }
+
+    REQUIRE(destroyed == 1);
+}
+
+TEST_CASE("SharedPtrSingleThreadedRefCount", "[SharedPtr]")
+{
+    testSingleThreadLifetime<isl::RefCountPolicy::SINGLE_THREADED>();
+}
+
+TEST_CASE("SharedPtrAtomicRefCount", "[SharedPtr]")
+{
+    testSingleThreadLifetime<isl::RefCountPolicy::ATOMIC>();
+}
+
+TEST_CASE("SharedPtrBiasedRefCount", "[SharedPtr]")
+{
+    testSingleThreadLifetime<isl::RefCountPolicy::BIASED>();
+}
+
+TEST_CASE("SharedPtrBiasedReleasedByOtherThread", "[SharedPtr]")
+{
+    using Ptr = CountedPtr<isl::RefCountPolicy::BIASED>;
+
+    auto destroyed = std::atomic<std::size_t>{};
+    auto ptr = Ptr{&destroyed};
+    auto copy = ptr;
+
+    // owner's count goes to one, the other thread drives the shared count negative
+    std::thread{[moved = std::move(copy)]() mutable { moved = nullptr; }}.join();
+    REQUIRE(destroyed == 0);
+
+    ptr = nullptr;
+    isl::processDeferredBiasedReleases();
+    REQUIRE(destroyed == 1);
+}
+
+TEST_CASE("SharedPtrBiasedSharedBetweenThreads", "[SharedPtr]")
+{
+    using Ptr = CountedPtr<isl::RefCountPolicy::BIASED>;
+
+    auto destroyed = std::atomic<std::size_t>{};
+    auto empty_copies = std::atomic<std::size_t>{};
+    auto ptr = Ptr{&destroyed};
+
+    // assertions are not thread-safe, failures are checked after join
+    std::thread{[ptr, &empty_copies]() {
+        for (std::size_t i = 0; i != 100; ++i) {
+            const auto copy = ptr;
+
+            if (copy.get() == nullptr) {
+                empty_copies.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }}.join();
+
+    REQUIRE(empty_copies == 0);
+
+    ptr = nullptr;
+    isl::processDeferredBiasedReleases();
+    REQUIRE(destroyed == 1);
+}
+
+TEST_CASE("SharedPtrBiasedOwnerExited", "[SharedPtr]")
+{
+    using Ptr = CountedPtr<isl::RefCountPolicy::BIASED>;
+
+    auto destroyed = std::atomic<std::size_t>{};
+    auto ptr = Ptr{};
+
+    std::thread{[&ptr, &destroyed]() { ptr = Ptr{&destroyed}; }}.join();
+    REQUIRE(destroyed == 0);
+
+    ptr = nullptr;
+    REQUIRE(destroyed == 1);
+}
+
+template <isl::RefCountPolicy Policy>
+static auto testWeakPtr() -> void
+{
+    using Ptr = CountedPtr<Policy>;
+    using Weak = isl::WeakPtr<DestructionCounter, FrameWithPolicy<Policy>, &FrameAllocator<Policy>>;
+
+    auto destroyed = std::atomic<std::size_t>{};
+    auto ptr = Ptr{&destroyed};
+    auto weak = Weak{ptr};
+    const auto weak_copy = weak;
+
+    REQUIRE_FALSE(weak.expired());
+
+    {
+        const auto locked = weak_copy.lock();
+        REQUIRE(locked.get() == ptr.get());
+    }
+
+    ptr = nullptr;
+
+    REQUIRE(destroyed == 1);
+    REQUIRE(weak.expired());
+    REQUIRE(weak_copy.lock() == nullptr);
+
+    // the frame is still owned by weak references, so it must not be reused yet
+    const auto other = Ptr{&destroyed};
+    REQUIRE(other.getFrame() != weak.getFrame());
+
+    weak.reset();
+    REQUIRE(weak.expired());
+}
+
+TEST_CASE("WeakPtrSingleThreaded", "[SharedPtr]")
+{
+    testWeakPtr<isl::RefCountPolicy::SINGLE_THREADED>();
+}
+
+TEST_CASE("WeakPtrAtomic", "[SharedPtr]")
+{
+    testWeakPtr<isl::RefCountPolicy::ATOMIC>();
+}
+
+TEST_CASE("WeakPtrLockRace", "[SharedPtr]")
+{
+    using Ptr = CountedPtr<isl::RefCountPolicy::ATOMIC>;
+    using Weak = isl::WeakPtr<
+        DestructionCounter, FrameWithPolicy<isl::RefCountPolicy::ATOMIC>,
+        &FrameAllocator<isl::RefCountPolicy::ATOMIC>>;
+
+    auto destroyed = std::atomic<std::size_t>{};
+    auto ptr = Ptr{&destroyed};
+    auto weak = Weak{ptr};
+    auto started = std::latch{1};
+    auto broken_locks = std::atomic<std::size_t>{};
+
+    // assertions are not thread-safe, failures are counted and checked after join
+    auto reader = std::thread{[weak, &destroyed, &started, &broken_locks]() {
+        auto expired = false;
+        started.count_down();
+
+        for (std::size_t locks_after_expiry = 0; locks_after_expiry != 1'000;) {
+            const auto locked = weak.lock();
+
+            if (locked == nullptr) {
+                expired = true;
+                ++locks_after_expiry;
+                continue;
+            }
+
+            // a locked object is alive and intact, an expired pointer is never locked again
+            if (expired || locked->counter != &destroyed || destroyed != 0) {
+                broken_locks.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+    }};
+
+    started.wait();
+    ptr = nullptr;
+    reader.join();
+
+    REQUIRE(broken_locks == 0);
+    REQUIRE(destroyed == 1);
+    REQUIRE(weak.expired());
+    REQUIRE(weak.lock() == nullptr);
+}
+
+TEST_CASE("SharedPtrRuntimeAllocator", "[SharedPtr]")
+{
+    using Frame =
+        isl::RuntimeAllocatedSharedPtrFrameFor<isl::RefCountPolicy::ATOMIC, DestructionCounter>;
+    using Ptr = isl::SharedPtr<DestructionCounter, Frame, &isl::RuntimeAllocator>;
+    using Weak = isl::WeakPtr<DestructionCounter, Frame, &isl::RuntimeAllocator>;
+
+    auto arena = isl::PoolAllocator<sizeof(Frame), alignof(Frame)>{};
+    auto destroyed = std::atomic<std::size_t>{};
+
+    STATIC_REQUIRE(sizeof(Ptr) == sizeof(Frame *));
+
+    auto ptr = Ptr{std::allocator_arg, arena, &destroyed};
+    auto weak = Weak{ptr};
+    auto *frame = ptr.getFrame();
+
+    ptr = nullptr;
+    REQUIRE(destroyed == 1);
+
+    weak.reset();
+    REQUIRE(static_cast<void *>(arena.getFirstFreeObject()) == static_cast<void *>(frame));
+}
+
+TEST_CASE("SharedPtrRuntimeAllocatorRejectsLargeFrames", "[SharedPtr]")
+{
+    using Frame =
+        isl::RuntimeAllocatedSharedPtrFrameFor<isl::RefCountPolicy::ATOMIC, DestructionCounter>;
+    using Ptr = isl::SharedPtr<DestructionCounter, Frame, &isl::RuntimeAllocator>;
+
+    auto small_arena = isl::PoolAllocator<sizeof(void *), alignof(void *)>{};
+    auto destroyed = std::atomic<std::size_t>{};
+
+    REQUIRE_THROWS_AS(Ptr(std::allocator_arg, small_arena, &destroyed), std::invalid_argument);
+    REQUIRE(small_arena.getFirstFreeObject() == nullptr);
+}
@@ -1,4 +1,5 @@
 #include <isl/detail/debug/debug.hpp>
+#include <isl/pool_allocator.hpp>
 #include <isl/small_function.hpp>
 
 TEST_CASE("SmallFunctionNoArgs", "[SmallFunction]")
@@ -84,3 +85,70 @@ TEST_CASE("SmallFunctionWithExceptionHandling", "[SmallFunction]")
 
     REQUIRE_THROWS_AS(a(), std::runtime_error);
 }
+
+TEST_CASE("SmallFunctionHeapFallback", "[SmallFunction]")
+{
+    using Function = isl::SmallFunction<std::size_t(), sizeof(std::size_t) * 4, &isl::HeapFallback>;
+
+    auto large_capture = std::array<std::size_t, 16>{};
+    large_capture.back() = 42;
+
+    const Function small{[]() { return std::size_t{1}; }};
+    const Function large{[large_capture]() { return large_capture.back(); }};
+    const Function large_copy = large;
+
+    REQUIRE(small() == 1);
+    REQUIRE(large() == 42);
+    REQUIRE(large_copy() == 42);
+
+    Function moved = std::move(large_copy);
+    REQUIRE(moved() == 42);
+}
+
+// NOLINTNEXTLINE
+static constinit auto CaptureAllocator =
+    isl::PoolAllocator<sizeof(std::array<std::size_t, 16>), alignof(std::size_t)>{};
+
+TEST_CASE("SmallFunctionPoolFallback", "[SmallFunction]")
+{
+    using Function = isl::SmallFunction<std::size_t(), sizeof(std::size_t) * 4, &CaptureAllocator>;
+
+    auto large_capture = std::array<std::size_t, 16>{};
+    large_capture.front() = 10;
+
+    const Function large{[large_capture]() { return large_capture.front(); }};
+    REQUIRE(large() == 10);
+    REQUIRE(CaptureAllocator.getFirstBlock() != nullptr);
+}
+
+TEST_CASE("SmallMoveOnlyFunction", "[SmallFunction]")
+{
+    isl::SmallMoveOnlyFunction<int()> a{[ptr = std::make_unique<int>(10)]() { return *ptr; }};
+    REQUIRE(a() == 10);
+
+    auto b = std::move(a);
+    REQUIRE(b() == 10);
+
+    STATIC_REQUIRE_FALSE(std::is_copy_constructible_v<isl::SmallMoveOnlyFunction<int()>>);
+    STATIC_REQUIRE(std::is_nothrow_move_constructible_v<isl::SmallMoveOnlyFunction<int()>>);
+}
+
+TEST_CASE("SmallFunctionNonTrivialCallable", "[SmallFunction]")
+{
+    auto shared = std::make_shared<int>(5);
+
+    {
+        isl::SmallFunction<int()> a{[shared]() { return *shared; }};
+        auto b = a;
+        const auto c = std::move(a);
+
+        REQUIRE(b() == 5);
+        REQUIRE(c() == 5);
+        REQUIRE(shared.use_count() == 3);
+
+        b = c;
+        REQUIRE(shared.use_count() == 3);
+    }
+
+    REQUIRE(shared.use_count() == 1);
+}
@@ -0,0 +1,49 @@
+#include <isl/detail/debug/debug.hpp>
+#include <isl/small_string.hpp>
+
+TEST_CASE("SmallStringStaysInline", "[SmallString]")
+{
+    auto str = isl::SmallString{"identifier_name"};
+
+    REQUIRE(str == "identifier_name");
+    REQUIRE(str.capacity() == 24);
+    STATIC_REQUIRE(sizeof(isl::SmallString) == 32);
+
+    str += "_with_suffix";
+    REQUIRE(str.view() == isl::string_view{"identifier_name_with_suffix"});
+    REQUIRE(str.capacity() > 24);
+}
+
+TEST_CASE("SmallStringAppendCodePoint", "[SmallString]")
+{
+    auto str = isl::SmallString{};
+
+    str.appendCodePoint(U'a').appendCodePoint(U'é').appendCodePoint(U'€');
+    str.appendCodePoint(U'\U0001F600');
+
+    REQUIRE(str == "aé€\U0001F600");
+    REQUIRE(str.size() == 10);
+    REQUIRE_THROWS_AS(str.appendCodePoint(char32_t{0x110000}), std::invalid_argument);
+}
+
+TEST_CASE("SmallStringCompareAndHash", "[SmallString]")
+{
+    // the templated overload exists only when both the hash and the equality are transparent
+    STATIC_REQUIRE(requires(const isl::SmallStringMap<int> &map, const isl::string_view key) {
+        map.template find<isl::string_view>(key);
+    });
+
+    auto map = isl::SmallStringMap<int>{};
+
+    map.emplace("first", 1);
+    map.emplace("second", 2);
+
+    REQUIRE(map.at("second") == 2);
+    REQUIRE(map.find(isl::string_view{"first"})->second == 1);
+    REQUIRE(map.contains(isl::string_view{"second"}));
+    REQUIRE_FALSE(map.contains(isl::string_view{"third"}));
+
+    REQUIRE(isl::SmallString{"abc"} < isl::SmallString{"abd"});
+    REQUIRE(fmt::format("{}", isl::SmallString{"text"}) == "text");
+    REQUIRE(static_cast<std::string>(isl::SmallString{"text"}) == "text");
+}
@@ -159,4 +159,213 @@ TEST_CASE("SmallVectorOfIntsErase", "[SmallVector]")
         vector.erase(vector.begin() + 3);
         REQUIRE(std::ranges::equal(vector, std::vector{1, 2, 3}));
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("SmallVectorOfIntsEraseRange", "[SmallVector]")
+{
+    auto vector = isl::SmallVector<int, 4>{1, 2, 3, 4, 5, 6};
+    auto *it = vector.erase(vector.begin() + 1, vector.begin() + 4);
+
+    REQUIRE(*it == 5);
+    REQUIRE(std::ranges::equal(vector, std::vector{1, 5, 6}));
+}
+
+TEST_CASE("SmallVectorOfIntsInsert", "[SmallVector]")
+{
+    auto vector = isl::SmallVector<int, 4>{1, 5};
+    const auto inserted = std::vector{2, 3, 4};
+
+    vector.insert(vector.begin() + 1, inserted.begin(), inserted.end());
+    REQUIRE(std::ranges::equal(vector, std::vector{1, 2, 3, 4, 5}));
+
+    vector.insert(vector.begin(), 0);
+    vector.insert(vector.end(), 2, 6);
+    vector.insert(vector.begin() + 1, vector[0]);
+    REQUIRE(std::ranges::equal(vector, std::vector{0, 0, 1, 2, 3, 4, 5, 6, 6}));
+}
+
+TEST_CASE("SmallVectorOfStringsInsert", "[SmallVector]")
+{
+    auto vector = isl::SmallVector<std::string, 2>{"a", "d"};
+    const auto inserted = std::vector<std::string>{"b", "c"};
+
+    vector.insert_range(vector.begin() + 1, inserted);
+    REQUIRE(std::ranges::equal(vector, std::vector<std::string>{"a", "b", "c", "d"}));
+
+    vector.emplace(vector.begin(), 3, 'z');
+    vector.erase(vector.end() - 1);
+    REQUIRE(std::ranges::equal(vector, std::vector<std::string>{"zzz", "a", "b", "c"}));
+}
+
+TEST_CASE("SmallVectorAppendAndAssign", "[SmallVector]")
+{
+    auto vector = isl::SmallVector<std::string, 2>{"first"};
+
+    vector.append(std::vector<std::string>{"second", "third"});
+    REQUIRE(vector.size() == 3);
+    REQUIRE(vector.capacity() >= 3);
+
+    vector.assign(std::vector<std::string>{"x"});
+    REQUIRE(std::ranges::equal(vector, std::vector<std::string>{"x"}));
+
+    vector.assign(4, "y");
+    REQUIRE(std::ranges::equal(vector, std::vector<std::string>(4, "y")));
+}
+
+TEST_CASE("SmallVectorResizeAndShrink", "[SmallVector]")
+{
+    auto vector = isl::SmallVector<std::string, 4>{};
+
+    vector.resize(10, "value");
+    REQUIRE(vector.size() == 10);
+    REQUIRE(vector.back() == "value");
+
+    vector.resize(3);
+    REQUIRE(vector.capacity() >= 10);
+
+    vector.shrink_to_fit();
+    REQUIRE(vector.capacity() == 4);
+    REQUIRE(std::ranges::equal(vector, std::vector<std::string>(3, "value")));
+
+    vector.emplace_back(vector.front());
+    vector.emplace_back(vector.front());
+    REQUIRE(vector.size() == 5);
+    REQUIRE(vector.back() == "value");
+}
+
+// Move constructor may throw, so the vector copies elements when it grows.
+struct ThrowingCopy
+{
+    static inline std::size_t copiesBeforeThrow = std::numeric_limits<std::size_t>::max();
+
+    std::string value;
+
+    explicit ThrowingCopy(std::string string)
+      : value{std::move(string)}
+    {}
+
+    ThrowingCopy(const ThrowingCopy &other)
+      : value{other.value}
+    {
+        if (copiesBeforeThrow-- == 0) {
+            throw std::runtime_error{"copy failed"};
+        }
+    }
+
+    // NOLINTNEXTLINE (performance-noexcept-move-constructor)
+    ThrowingCopy(ThrowingCopy &&other)
+      : value{std::move(other.value)}
+    {}
+
+    ~ThrowingCopy() = default;
+
+    auto operator=(const ThrowingCopy &) -> ThrowingCopy & = default;
+    auto operator=(ThrowingCopy &&) -> ThrowingCopy & = default;
+};
+
+TEST_CASE("SmallVectorGrowthKeepsElementsOnException", "[SmallVector]")
+{
+    auto vector = isl::SmallVector<ThrowingCopy, 2>{};
+
+    for (const auto *value : {"a", "b", "c"}) {
+        vector.emplace_back(value);
+    }
+
+    const auto capacity = vector.capacity();
+
+    while (vector.size() != capacity) {
+        vector.emplace_back("filler");
+    }
+
+    ThrowingCopy::copiesBeforeThrow = 1;
+    REQUIRE_THROWS_AS(vector.emplace_back("d"), std::runtime_error);
+    ThrowingCopy::copiesBeforeThrow = 1;
+    REQUIRE_THROWS_AS(vector.reserve(capacity * 4), std::runtime_error);
+    ThrowingCopy::copiesBeforeThrow = std::numeric_limits<std::size_t>::max();
+
+    REQUIRE(vector.size() == capacity);
+    REQUIRE(vector.capacity() == capacity);
+    REQUIRE(vector[0].value == "a");
+    REQUIRE(vector[2].value == "c");
+
+    vector.emplace_back("d");
+    REQUIRE(vector.back().value == "d");
+    REQUIRE(vector[1].value == "b");
+}
+
+TEST_CASE("SmallVectorGrowthPolicy", "[SmallVector]")
+{
+    using Vector = isl::SmallVector<int, 4, std::allocator<int>, isl::SmallVectorGrowth<3, 2>>;
+
+    auto vector = Vector{1, 2, 3, 4};
+    vector.emplace_back(5);
+
+    REQUIRE(vector.capacity() == 6);
+}
+
+TEST_CASE("SmallVectorSwap", "[SmallVector]")
+{
+    auto small = isl::SmallVector<std::string, 2>{"a"};
+    auto large = isl::SmallVector<std::string, 2>{"b", "c", "d"};
+
+    small.swap(large);
+    REQUIRE(std::ranges::equal(small, std::vector<std::string>{"b", "c", "d"}));
+    REQUIRE(std::ranges::equal(large, std::vector<std::string>{"a"}));
+
+    large.swap(small);
+    REQUIRE(std::ranges::equal(large, std::vector<std::string>{"b", "c", "d"}));
+    REQUIRE(std::ranges::equal(small, std::vector<std::string>{"a"}));
+}
+
+TEST_CASE("SmallVectorCompactSizeType", "[SmallVector]")
+{
+    using Vector =
+        isl::SmallVector<char, 22, std::allocator<char>, isl::SmallVectorGrowth<>, isl::u8>;
+
+    STATIC_REQUIRE(sizeof(Vector) == 24);
+    STATIC_REQUIRE(Vector::max_size() == 255);
+
+    auto vector = Vector{};
+
+    for (std::size_t i = 0; i != 255; ++i) {
+        vector.emplace_back('a');
+    }
+
+    REQUIRE(vector.size() == 255);
+    REQUIRE(std::ranges::all_of(vector, [](char chr) { return chr == 'a'; }));
+    REQUIRE_THROWS_AS(vector.emplace_back('b'), std::length_error);
+}
+
+TEST_CASE("SmallVectorInsertCountPastMaxSize", "[SmallVector]")
+{
+    using Vector =
+        isl::SmallVector<char, 22, std::allocator<char>, isl::SmallVectorGrowth<>, isl::u8>;
+
+    auto vector = Vector(200, 'a');
+
+    REQUIRE_THROWS_AS(vector.insert(vector.begin() + 100, 100, 'b'), std::length_error);
+    REQUIRE(vector.size() == 200);
+    REQUIRE(std::ranges::all_of(vector, [](char chr) { return chr == 'a'; }));
+
+    vector.insert(vector.begin() + 100, 55, 'b');
+
+    REQUIRE(vector.size() == 255);
+    REQUIRE(vector[99] == 'a');
+    REQUIRE(vector[100] == 'b');
+    REQUIRE(vector[154] == 'b');
+    REQUIRE(vector[155] == 'a');
+}
+
+TEST_CASE("SmallVectorWideSizeType", "[SmallVector]")
+{
+    using Vector = isl::SmallVector<
+        isl::u16, 8, std::allocator<isl::u16>, isl::SmallVectorGrowth<>, isl::u64>;
+
+    auto vector = Vector{1, 2, 3};
+    vector.resize(100, 4);
+
+    REQUIRE(vector.size() == 100);
+    REQUIRE(vector[2] == 3);
+    REQUIRE(vector.back() == 4);
+    STATIC_REQUIRE(std::same_as<Vector::size_type, isl::u64>);
+}
@@ -0,0 +1,74 @@
+#include <isl/detail/debug/debug.hpp>
+#include <isl/string_interner.hpp>
+#include <thread>
+
+TEST_CASE("StringInternerReturnsSameId", "[StringInterner]")
+{
+    auto interner = isl::StringInterner{};
+    auto source = std::string{"identifier"};
+
+    const auto first = interner.intern(source);
+    source = "changed";
+
+    const auto second = interner.intern("identifier");
+    const auto other = interner.intern("other");
+
+    REQUIRE(first == second);
+    REQUIRE(first.str.data() == second.str.data());
+    REQUIRE(first.str == "identifier");
+    REQUIRE_FALSE(first == other);
+
+    REQUIRE(interner.getString(other.id) == "other");
+    REQUIRE(interner.find("identifier")->id == first.id);
+    REQUIRE_FALSE(interner.find("missing").has_value());
+    REQUIRE(interner.size() == 2);
+}
+
+TEST_CASE("StringInternerLongStrings", "[StringInterner]")
+{
+    auto interner = isl::StringInterner{};
+    const auto long_string = std::string(100'000, 'x');
+
+    const auto interned = interner.intern(long_string);
+    REQUIRE(interned.str == long_string);
+    REQUIRE(interner.intern(long_string).id == interned.id);
+    REQUIRE(interner.intern("").str.empty());
+}
+
+TEST_CASE("StringInternerConcurrentIntern", "[StringInterner]")
+{
+    static constexpr std::size_t threads_count = 8;
+    static constexpr std::size_t strings_count = 2'000;
+
+    auto interner = isl::StringInterner{};
+    auto strings = std::vector<std::string>{};
+    auto ids = std::vector<std::vector<isl::SmallId>>(threads_count);
+
+    for (std::size_t i = 0; i != strings_count; ++i) {
+        strings.emplace_back(fmt::format("identifier_{}", i));
+    }
+
+    auto threads = std::vector<std::thread>{};
+
+    for (std::size_t t = 0; t != threads_count; ++t) {
+        threads.emplace_back([&interner, &strings, &thread_ids = ids[t]]() {
+            for (const auto &str : strings) {
+                thread_ids.emplace_back(interner.intern(str).id);
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(interner.size() == strings_count);
+
+    for (const auto &thread_ids : ids) {
+        REQUIRE(thread_ids == ids.front());
+    }
+
+    for (std::size_t i = 0; i != strings_count; ++i) {
+        REQUIRE(interner.getString(ids.front()[i]) == strings[i]);
+    }
+}
@@ -0,0 +1,159 @@
+#include <isl/code_point_index.hpp>
+#include <isl/detail/debug/debug.hpp>
+#include <isl/string_view.hpp>
+#include <random>
+
+static_assert(std::ranges::bidirectional_range<decltype(isl::string_view{}.codepoints())>);
+static_assert(std::ranges::view<decltype(isl::u8string_view{}.codepoints())>);
+
+static auto toCodePoints(const isl::string_view str) -> std::u32string
+{
+    auto result = std::u32string{};
+
+    for (const char32_t chr : str.codepoints()) {
+        result.push_back(chr);
+    }
+
+    return result;
+}
+
+// Mostly well-formed text with ill-formed bytes sometimes
+static auto makeRandomText(std::mt19937 &engine, const std::size_t count) -> std::string
+{
+    auto kind_distribution = std::uniform_int_distribution<int>{0, 5};
+    auto byte_distribution = std::uniform_int_distribution<int>{0x80, 0xFF};
+    auto result = std::string{};
+    auto inserter = std::back_inserter(result);
+
+    for (std::size_t i = 0; i != count; ++i) {
+        switch (kind_distribution(engine)) {
+        case 0:
+            result.push_back(static_cast<char>(byte_distribution(engine)));
+            break;
+
+        case 1:
+            isl::utf8::appendUtf32ToUtf8Container(inserter, U'п');
+            break;
+
+        case 2:
+            isl::utf8::appendUtf32ToUtf8Container(inserter, U'語');
+            break;
+
+        case 3:
+            isl::utf8::appendUtf32ToUtf8Container(inserter, U'\U0001F600');
+            break;
+
+        default:
+            result.push_back('a');
+            break;
+        }
+    }
+
+    return result;
+}
+
+TEST_CASE("StringViewCodePoints", "[StringView]")
+{
+    using namespace isl::string_view_literals;
+
+    REQUIRE(toCodePoints("").empty());
+    REQUIRE(toCodePoints("aп語\xF0\x9F\x98\x80") == U"aп語\U0001F600");
+
+    // ill-formed lead bytes, overlong and surrogate sequences, extra continuation bytes
+    REQUIRE(toCodePoints("a\xFF" "b") == U"a�b");
+    REQUIRE(toCodePoints("\x80\x80" "a") == U"�a");
+    REQUIRE(toCodePoints("\xC0\xAF\xED\xA0\x80") == U"��");
+    REQUIRE(toCodePoints("\xD0\xBF\x80" "a\xD0") == U"�a�");
+
+    const auto view = "aп語\xF0\x9F\x98\x80"_sv.codepoints();
+    auto reversed = std::u32string{};
+
+    for (auto it = view.end(); it != view.begin();) {
+        --it;
+        reversed.push_back(*it);
+    }
+
+    REQUIRE(reversed == U"\U0001F600語пa");
+    REQUIRE(std::ranges::next(view.begin(), 2).base() == view.begin().base() + 3);
+
+    STATIC_REQUIRE(std::ranges::distance("aп語\xF0\x9F\x98\x80"_sv.codepoints()) == 4);
+    STATIC_REQUIRE(*std::ranges::next(u8"aп語"_sv.codepoints().begin()) == U'п');
+}
+
+TEST_CASE("StringViewFindCodePoint", "[StringView]")
+{
+    using namespace isl::string_view_literals;
+
+    STATIC_REQUIRE("aп語п"_sv.findCodePoint(U'п') == 1);
+    STATIC_REQUIRE("aп語п"_sv.findCodePoint(U'п', 2) == 6);
+    STATIC_REQUIRE("aп語п"_sv.findCodePoint(U'a') == 0);
+    STATIC_REQUIRE(u8"aп語"_sv.findCodePoint(U'語') == 3);
+    STATIC_REQUIRE("aп語"_sv.containsCodePoint(U'語'));
+    STATIC_REQUIRE(!"aп語"_sv.containsCodePoint(U'\U0001F600'));
+
+    // code units are still searched by the overloads for characters
+    STATIC_REQUIRE(u8"abc"_sv.find('b') == 1);
+    STATIC_REQUIRE(u8"abc"_sv.contains('b'));
+    STATIC_REQUIRE("abc"_sv.find(0x63) == 2);
+
+    // values, which are not code points, have no encoding
+    STATIC_REQUIRE("\xED\xA0\x80"_sv.findCodePoint(char32_t{0xD800}) == isl::string_view::npos);
+    STATIC_REQUIRE(
+        "\xF4\x90\x80\x80"_sv.findCodePoint(char32_t{0x110000}) == isl::string_view::npos);
+
+    auto engine = std::mt19937{42};
+
+    for (std::size_t count = 0; count != 200; ++count) {
+        const auto text = makeRandomText(engine, count);
+        const auto own_view = isl::string_view{text};
+
+        for (const char32_t chr : {U'a', U'п', U'語', U'\U0001F600', U'b'}) {
+            auto encoded = std::string{};
+            isl::utf8::appendUtf32ToUtf8Container(std::back_inserter(encoded), chr);
+
+            for (std::size_t offset = 0; offset <= text.size(); offset += 7) {
+                REQUIRE(own_view.findCodePoint(chr, offset) == text.find(encoded, offset));
+            }
+        }
+    }
+}
+
+TEST_CASE("StringViewCodePointSubstr", "[StringView]")
+{
+    using namespace isl::string_view_literals;
+
+    STATIC_REQUIRE("aп語\xF0\x9F\x98\x80"_sv.codePointSubstr(1, 2) == "п語"_sv);
+    STATIC_REQUIRE("aп語\xF0\x9F\x98\x80"_sv.codePointSubstr(2) == "語\xF0\x9F\x98\x80"_sv);
+    STATIC_REQUIRE("aп語"_sv.codePointSubstr(5).empty());
+    STATIC_REQUIRE("aп語"_sv.codePointOffset(2) == 3);
+    STATIC_REQUIRE("aп語"_sv.codePointOffset(1, 1) == 3);
+    STATIC_REQUIRE("aп語"_sv.codePointOffset(10) == 6);
+}
+
+TEST_CASE("CodePointIndex", "[StringView]")
+{
+    auto engine = std::mt19937{7};
+
+    for (const auto count : std::to_array<std::size_t>({0, 1, 7, 63, 64, 65, 200, 1000, 5000})) {
+        const auto text = makeRandomText(engine, count);
+        const auto view = isl::string_view{text};
+        const auto index = isl::CodePointIndex{view};
+        const auto code_points = toCodePoints(view);
+
+        REQUIRE(index.size() == code_points.size());
+        REQUIRE(index.offsetOf(index.size()) == text.size());
+
+        for (std::size_t i = 0; i != index.size(); ++i) {
+            REQUIRE(index.offsetOf(i) == view.codePointOffset(i));
+            REQUIRE(index[i] == code_points[i]);
+        }
+
+        for (std::size_t first = 0; first <= index.size() + 1; first += 13) {
+            for (const std::size_t len : {std::size_t{0}, std::size_t{5}, isl::string_view::npos}) {
+                REQUIRE(index.substr(first, len) == view.codePointSubstr(first, len));
+            }
+        }
+
+        REQUIRE_THROWS_AS(index.at(index.size()), std::out_of_range);
+    }
+}
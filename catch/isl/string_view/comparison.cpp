@@ -1,5 +1,6 @@
 #include <isl/detail/debug/debug.hpp>
 #include <isl/string_view.hpp>
+#include <random>
 
 TEST_CASE("StringViewComparisonEqual", "[StringView]")
 {
@@ -44,3 +45,48 @@ TEST_CASE("StringViewComparisonGreaterFirstGreater", "[StringView]")
     STATIC_REQUIRE(own_string > std_string);
     STATIC_REQUIRE(own_string >= std_string);
 }
+
+TEST_CASE("StringViewComparisonRandom", "[StringView]")
+{
+    auto engine = std::mt19937{42};
+    auto length_distribution = std::uniform_int_distribution<std::size_t>{0, 80};
+    auto character_distribution = std::uniform_int_distribution<int>{-128, 127};
+
+    // strings share long prefixes, so mismatches are found in every vector block and tail
+    const auto prefix = std::string(70, 'a');
+
+    for (std::size_t i = 0; i != 2000; ++i) {
+        auto lhs = prefix.substr(0, length_distribution(engine));
+        auto rhs = prefix.substr(0, length_distribution(engine));
+
+        if (!lhs.empty() && i % 2 == 0) {
+            lhs[length_distribution(engine) % lhs.size()] =
+                static_cast<char>(character_distribution(engine));
+        }
+
+        const auto own_lhs = isl::string_view{lhs};
+        const auto own_rhs = isl::string_view{rhs};
+
+        const auto expected = std::lexicographical_compare_three_way(
+            lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+
+        REQUIRE((own_lhs <=> own_rhs) == expected);
+        REQUIRE((own_lhs <=> rhs) == expected);
+        REQUIRE((own_lhs == own_rhs) == (lhs == rhs));
+        REQUIRE((own_lhs == rhs) == (lhs == rhs));
+    }
+}
+
+TEST_CASE("StringViewComparisonWideCharacters", "[StringView]")
+{
+    const auto lhs = std::u32string(40, U'x') + U'\U0001F600';
+    const auto rhs = std::u32string(40, U'x') + U'é';
+
+    const auto own_lhs = isl::BasicStringView<char32_t>{lhs.data(), lhs.size()};
+    const auto own_rhs = isl::BasicStringView<char32_t>{rhs.data(), rhs.size()};
+
+    REQUIRE(own_lhs > own_rhs);
+    REQUIRE(own_lhs != own_rhs);
+    REQUIRE(own_lhs == lhs);
+    REQUIRE((own_lhs <=> lhs) == std::strong_ordering::equal);
+}
@@ -1,5 +1,6 @@
 #include <isl/detail/debug/debug.hpp>
 #include <isl/string_view.hpp>
+#include <random>
 
 
 TEST_CASE("StringViewOpenCloseFind", "[StringView]")
@@ -9,3 +10,70 @@ TEST_CASE("StringViewOpenCloseFind", "[StringView]")
     constexpr static auto own_string = "(Hello(, )World)!"_sv;
     STATIC_REQUIRE(own_string.findRangeEnd('(', ')') == own_string.rfind(')'));
 }
+
+TEST_CASE("StringViewQuotedOpenCloseFind", "[StringView]")
+{
+    using namespace isl::string_view_literals;
+
+    constexpr static auto own_string = R"({ "}", "\"}", { } } })"_sv;
+    STATIC_REQUIRE(own_string.findQuotedRangeEnd('{', '}', '"', '\\') == own_string.size() - 3);
+    STATIC_REQUIRE(own_string.findRangeEnd('{', '}') == 3);
+}
+
+static auto findRangeEndReference(const std::string_view str, const bool quote_aware)
+    -> std::size_t
+{
+    auto depth = std::ptrdiff_t{};
+    auto in_string = false;
+    auto escaped = false;
+
+    for (std::size_t i = 0; i != str.size(); ++i) {
+        const auto chr = str[i];
+
+        if (quote_aware && escaped) {
+            escaped = false;
+        } else if (quote_aware && chr == '\\') {
+            escaped = true;
+        } else if (quote_aware && chr == '"') {
+            in_string = !in_string;
+        } else if (!in_string) {
+            depth += static_cast<std::ptrdiff_t>(chr == '(');
+            depth -= static_cast<std::ptrdiff_t>(chr == ')');
+        }
+
+        if (depth == 0) {
+            return i;
+        }
+    }
+
+    return isl::string_view::npos;
+}
+
+TEST_CASE("StringViewOpenCloseFindRandom", "[StringView]")
+{
+    // depth is a random walk, so ranges often span several 64 byte blocks
+    static constexpr auto alphabet = std::string_view{"((()))xy\"\\"};
+
+    auto engine = std::mt19937{42};
+    auto character_distribution =
+        std::uniform_int_distribution<std::size_t>{0, alphabet.size() - 1};
+    auto length_distribution = std::uniform_int_distribution<std::size_t>{0, 400};
+
+    for (std::size_t i = 0; i != 3000; ++i) {
+        auto str = std::string(length_distribution(engine), ' ');
+
+        for (auto &chr : str) {
+            chr = alphabet[character_distribution(engine)];
+        }
+
+        if (!str.empty() && i % 8 != 0) {
+            str.front() = '(';
+        }
+
+        const auto own_view = isl::string_view{str};
+
+        REQUIRE(own_view.findRangeEnd('(', ')') == findRangeEndReference(str, false));
+        REQUIRE(
+            own_view.findQuotedRangeEnd('(', ')', '"', '\\') == findRangeEndReference(str, true));
+    }
+}
@@ -0,0 +1,134 @@
+#include "../detail/kernel_sets.hpp"
+
+#include <isl/detail/debug/debug.hpp>
+#include <isl/string_view.hpp>
+#include <random>
+
+// Lengths cover the scalar tails and several vector blocks of every instruction set.
+static constexpr std::size_t MaxLength = 140;
+
+static auto makeRandomString(std::mt19937 &engine, const std::size_t length) -> std::string
+{
+    // small alphabet makes matches frequent, high bytes check sign handling
+    static constexpr auto alphabet = std::string_view{"abc \t\xE0\xFF"};
+    auto distribution = std::uniform_int_distribution<std::size_t>{0, alphabet.size() - 1};
+    auto result = std::string(length, ' ');
+
+    for (auto &chr : result) {
+        chr = alphabet[distribution(engine)];
+    }
+
+    return result;
+}
+
+TEST_CASE("StringViewSimdFindCharacter", "[StringView]")
+{
+    forEachKernelSet([] {
+        auto engine = std::mt19937{42};
+
+        for (std::size_t length = 0; length != MaxLength; ++length) {
+            const auto std_string = makeRandomString(engine, length);
+            const auto std_view = std::string_view{std_string};
+            const auto own_view = isl::string_view{std_string};
+
+            for (const char chr : {'a', ' ', '\xE0', '\xFF', 'z'}) {
+                for (std::size_t offset = 0; offset <= length; ++offset) {
+                    REQUIRE(own_view.find(chr, offset) == std_view.find(chr, offset));
+                }
+
+                REQUIRE(own_view.contains(chr) == (std_view.find(chr) != std::string_view::npos));
+
+                const auto last = std_view.rfind(chr);
+                REQUIRE(own_view.rfind(chr) == last);
+
+                if (last != std::string_view::npos && last != 0) {
+                    REQUIRE(own_view.rfind(chr, length - last) == std_view.rfind(chr, last - 1));
+                }
+            }
+        }
+    });
+}
+
+TEST_CASE("StringViewSimdFindOf", "[StringView]")
+{
+    forEachKernelSet([] {
+        auto engine = std::mt19937{7};
+
+        for (std::size_t length = 0; length != MaxLength; ++length) {
+            const auto std_string = makeRandomString(engine, length);
+            const auto std_view = std::string_view{std_string};
+            const auto own_view = isl::string_view{std_string};
+
+            for (const std::string_view set : {"", "a", "ab", " \t", "\xE0\xFF", "abc \t\xE0"}) {
+                for (std::size_t offset = 0; offset <= length; ++offset) {
+                    REQUIRE(
+                        own_view.findFirstOf(set, offset) == std_view.find_first_of(set, offset));
+                    REQUIRE(
+                        own_view.findFirstNotOf(set, offset) ==
+                        std_view.find_first_not_of(set, offset));
+                }
+
+                const auto first = std_view.find_first_not_of(set);
+                const auto last = std_view.find_last_not_of(set);
+
+                const auto expected_lstrip =
+                    first == std::string_view::npos ? std::string_view{} : std_view.substr(first);
+                const auto expected_rstrip = last == std::string_view::npos
+                                                 ? std::string_view{}
+                                                 : std_view.substr(0, last + 1);
+                const auto expected_strip = first == std::string_view::npos
+                                                ? std::string_view{}
+                                                : std_view.substr(first, last - first + 1);
+
+                REQUIRE(own_view.lstrip(set) == expected_lstrip);
+                REQUIRE(own_view.rstrip(set) == expected_rstrip);
+                REQUIRE(own_view.strip(set) == expected_strip);
+            }
+        }
+    });
+}
+
+TEST_CASE("StringViewSimdFindSubstring", "[StringView]")
+{
+    forEachKernelSet([] {
+        auto engine = std::mt19937{13};
+
+        for (std::size_t length = 0; length != MaxLength; ++length) {
+            const auto std_string = makeRandomString(engine, length);
+            const auto std_view = std::string_view{std_string};
+            const auto own_view = isl::string_view{std_string};
+
+            for (std::size_t substring_length = 0; substring_length != 6; ++substring_length) {
+                const auto substring = makeRandomString(engine, substring_length);
+
+                for (std::size_t offset = 0; offset <= length + 1; ++offset) {
+                    REQUIRE(own_view.find(substring, offset) == std_view.find(substring, offset));
+                }
+
+                REQUIRE(
+                    own_view.contains(substring) ==
+                    (std_view.find(substring) != std::string_view::npos));
+            }
+
+            if (length > 10) {
+                const auto existing = std_view.substr(length / 2, 7);
+                REQUIRE(own_view.find(existing) == std_view.find(existing));
+            }
+        }
+    });
+}
+
+TEST_CASE("StringViewSearchConstexpr", "[StringView]")
+{
+    using namespace isl::string_view_literals;
+
+    constexpr static auto own_string = "Hello, World! Hello!"_sv;
+
+    STATIC_REQUIRE(own_string.find("Hello"_sv) == 0);
+    STATIC_REQUIRE(own_string.find("Hello"_sv, 1) == 14);
+    STATIC_REQUIRE(own_string.find("Bye"_sv) == isl::string_view::npos);
+    STATIC_REQUIRE(own_string.contains("World"_sv));
+    STATIC_REQUIRE(own_string.findFirstOf(",!"_sv) == 5);
+    STATIC_REQUIRE(own_string.findFirstNotOf("Hel"_sv) == 4);
+    STATIC_REQUIRE(own_string.findFirstOf("xyz"_sv) == isl::string_view::npos);
+}
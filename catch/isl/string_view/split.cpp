@@ -0,0 +1,140 @@
+#include <isl/detail/debug/debug.hpp>
+#include <isl/string_view.hpp>
+#include <random>
+#include <sstream>
+
+static_assert(std::ranges::forward_range<decltype(isl::string_view{}.splitBy(','))>);
+static_assert(std::ranges::forward_range<decltype(isl::string_view{}.lines())>);
+static_assert(std::ranges::view<decltype(isl::string_view{}.splitWhitespace())>);
+
+template<std::ranges::range R>
+static auto toStrings(R &&range) -> std::vector<std::string>
+{
+    auto result = std::vector<std::string>{};
+
+    for (const auto &part : range) {
+        result.emplace_back(std::string_view{part.data(), part.size()});
+    }
+
+    return result;
+}
+
+static auto makeRandomString(std::mt19937 &engine, const std::size_t length) -> std::string
+{
+    static constexpr auto alphabet = std::string_view{"ab,;  \t\n\r"};
+    auto distribution = std::uniform_int_distribution<std::size_t>{0, alphabet.size() - 1};
+    auto result = std::string(length, ' ');
+
+    for (auto &chr : result) {
+        chr = alphabet[distribution(engine)];
+    }
+
+    return result;
+}
+
+TEST_CASE("StringViewSplitBy", "[StringView]")
+{
+    using namespace isl::string_view_literals;
+
+    REQUIRE(toStrings("a,b,,c"_sv.splitBy(',')) == std::vector<std::string>{"a", "b", "", "c"});
+    REQUIRE(toStrings(",a,"_sv.splitBy(',')) == std::vector<std::string>{"", "a", ""});
+    REQUIRE(toStrings(""_sv.splitBy(',')).empty());
+
+    auto engine = std::mt19937{42};
+
+    for (std::size_t length = 0; length != 200; ++length) {
+        const auto str = makeRandomString(engine, length);
+        const auto expected = toStrings(std::views::split(std::string_view{str}, ','));
+
+        REQUIRE(toStrings(isl::string_view{str}.splitBy(',')) == expected);
+    }
+}
+
+TEST_CASE("StringViewSplitByAny", "[StringView]")
+{
+    using namespace isl::string_view_literals;
+
+    REQUIRE(
+        toStrings("a,b;;c"_sv.splitByAny(",;")) == std::vector<std::string>{"a", "b", "", "c"});
+
+    auto engine = std::mt19937{7};
+
+    for (std::size_t length = 0; length != 200; ++length) {
+        const auto str = makeRandomString(engine, length);
+        auto expected = std::vector<std::string>{};
+
+        if (!str.empty()) {
+            auto first = std::size_t{};
+
+            while (true) {
+                const auto last = str.find_first_of(",;", first);
+                expected.emplace_back(str.substr(first, last - first));
+
+                if (last == std::string::npos) {
+                    break;
+                }
+
+                first = last + 1;
+            }
+        }
+
+        REQUIRE(toStrings(isl::string_view{str}.splitByAny(",;")) == expected);
+    }
+}
+
+TEST_CASE("StringViewLines", "[StringView]")
+{
+    using namespace isl::string_view_literals;
+
+    REQUIRE(toStrings("a\nb\r\n\nc"_sv.lines()) == std::vector<std::string>{"a", "b", "", "c"});
+    REQUIRE(toStrings("a\n"_sv.lines()) == std::vector<std::string>{"a"});
+    REQUIRE(toStrings("\n"_sv.lines()) == std::vector<std::string>{""});
+    REQUIRE(toStrings(""_sv.lines()).empty());
+
+    auto engine = std::mt19937{13};
+
+    for (std::size_t length = 0; length != 200; ++length) {
+        const auto str = makeRandomString(engine, length);
+        auto stream = std::istringstream{str};
+        auto expected = std::vector<std::string>{};
+
+        for (auto line = std::string{}; std::getline(stream, line);) {
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+
+            expected.emplace_back(std::move(line));
+        }
+
+        REQUIRE(toStrings(isl::string_view{str}.lines()) == expected);
+    }
+}
+
+TEST_CASE("StringViewSplitWhitespace", "[StringView]")
+{
+    auto engine = std::mt19937{17};
+
+    for (std::size_t length = 0; length != 200; ++length) {
+        const auto str = makeRandomString(engine, length);
+        auto stream = std::istringstream{str};
+        auto expected = std::vector<std::string>{};
+
+        for (auto word = std::string{}; stream >> word;) {
+            expected.emplace_back(std::move(word));
+        }
+
+        REQUIRE(toStrings(isl::string_view{str}.splitWhitespace()) == expected);
+    }
+}
+
+TEST_CASE("StringViewSplitConstexpr", "[StringView]")
+{
+    using namespace isl::string_view_literals;
+
+    STATIC_REQUIRE(std::ranges::distance("a b  c\t"_sv.splitWhitespace()) == 3);
+    STATIC_REQUIRE(std::ranges::distance("a,b,"_sv.splitBy(',')) == 3);
+    STATIC_REQUIRE(*std::ranges::next("a\r\nbc\n"_sv.lines().begin()) == "bc"_sv);
+
+    STATIC_REQUIRE(
+        std::ranges::distance(isl::u16string_view{u"x y"}.splitWhitespace()) == 2);
+}
@@ -41,4 +41,69 @@ TEST_CASE("UniqueAnyUniquePtr", "[UniqueAny]")
     REQUIRE(*object_back == "Hello, World! It's a long string!");
 
     REQUIRE_THROWS(isl::get<std::string>(object));
-}
\ No newline at end of file
+}
+
+TEST_CASE("UniqueAnyStoresSmallObjectsInline", "[UniqueAny]")
+{
+    auto object = isl::makeAny<std::string>("Hello, World!");
+    REQUIRE(object.storesInline());
+
+    auto moved = std::move(object);
+    REQUIRE_FALSE(object.hasValue());
+    REQUIRE(moved.storesInline());
+    REQUIRE(*isl::observe<std::string>(moved) == "Hello, World!");
+
+    STATIC_REQUIRE(sizeof(isl::UniqueAny) == isl::UniqueAny::getBufferSize() + sizeof(void *));
+}
+
+TEST_CASE("UniqueAnyConfigurableBuffer", "[UniqueAny]")
+{
+    using Payload = std::array<std::string, 1>;
+    using Message = std::pair<std::string, std::size_t>;
+
+    auto small_any = isl::UniqueAny{Message{"message", 42}};
+    auto large_any = isl::BasicUniqueAny<48>{Message{"message", 42}};
+
+    REQUIRE_FALSE(small_any.storesInline());
+    REQUIRE(large_any.storesInline());
+    REQUIRE(isl::get<Message>(large_any).second == 42);
+    REQUIRE_FALSE(large_any.hasValue());
+
+    large_any.emplace<Payload>(Payload{"payload"});
+    REQUIRE(isl::observe<Payload>(large_any)->front() == "payload");
+    REQUIRE_THROWS_AS(isl::observe<Message>(large_any), isl::bad_unique_any_cast);
+}
+
+TEST_CASE("UniqueAnyAdoptsUniquePtr", "[UniqueAny]")
+{
+    auto object = isl::UniqueAny{std::make_unique<int>(10)};
+
+    REQUIRE_FALSE(object.storesInline());
+    REQUIRE(*isl::observe<int>(object) == 10);
+    REQUIRE(isl::get<int>(object) == 10);
+}
+
+TEST_CASE("UniqueAnyReleasesInlineObject", "[UniqueAny]")
+{
+    auto object = isl::makeAny<std::string>("Hello, World!");
+    REQUIRE(object.storesInline());
+
+    const auto released = object.release<std::string>();
+    REQUIRE(*released == "Hello, World!");
+    REQUIRE_FALSE(object.hasValue());
+    REQUIRE_THROWS_AS(object.release<std::string>(), isl::bad_unique_any_cast);
+}
+
+TEST_CASE("UniqueAnyReleasesHeapObject", "[UniqueAny]")
+{
+    auto adopted = std::make_unique<int>(10);
+    auto *const address = adopted.get();
+    auto object = isl::UniqueAny{std::move(adopted)};
+
+    REQUIRE_THROWS_AS(object.release<long>(), isl::bad_unique_any_cast);
+
+    const auto released = object.release<int>();
+    REQUIRE(released.get() == address);
+    REQUIRE(*released == 10);
+    REQUIRE_FALSE(object.hasValue());
+}
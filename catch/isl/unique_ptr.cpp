@@ -0,0 +1,57 @@
+#include <isl/detail/debug/debug.hpp>
+#include <isl/memory.hpp>
+
+using StringPool = isl::PoolAllocator<sizeof(std::string), alignof(std::string)>;
+
+// NOLINTNEXTLINE
+static constinit auto GlobalStringPool = StringPool{};
+
+TEST_CASE("UniquePtrStaticAllocatorHasNoOverhead", "[UniquePtr]")
+{
+    using Ptr = isl::UniquePtr<std::string, &GlobalStringPool>;
+
+    STATIC_REQUIRE(sizeof(Ptr) == sizeof(std::string *));
+
+    const auto ptr = Ptr{"Hello, World!"};
+    REQUIRE(*ptr == "Hello, World!");
+}
+
+TEST_CASE("UniquePtrRuntimeAllocator", "[UniquePtr]")
+{
+    using Ptr = isl::UniquePtr<std::string, &isl::RuntimeAllocator>;
+
+    auto first_arena = StringPool{};
+    auto second_arena = StringPool{};
+
+    auto first = Ptr{std::allocator_arg, first_arena, "first"};
+    auto second = Ptr{std::allocator_arg, second_arena, "second"};
+
+    REQUIRE(first.getAllocator().get() == &first_arena);
+    REQUIRE(second.getAllocator().get() == &second_arena);
+
+    first = std::move(second);
+    REQUIRE(*first == "second");
+    REQUIRE(first.getAllocator().get() == &second_arena);
+
+    second = nullptr;
+
+    // the string from the second arena must return there, so the next allocation reuses it
+    auto *released_address = first.get();
+    first = nullptr;
+
+    const auto reused = Ptr{std::allocator_arg, second_arena, "reused"};
+    REQUIRE(reused.get() == released_address);
+
+    const auto default_constructed = Ptr::createDefault(first_arena);
+    REQUIRE(default_constructed->empty());
+}
+
+TEST_CASE("UniquePtrRuntimeAllocatorRejectsLargeObjects", "[UniquePtr]")
+{
+    using Ptr = isl::UniquePtr<std::string, &isl::RuntimeAllocator>;
+
+    auto small_arena = isl::PoolAllocator<sizeof(char), alignof(char)>{};
+
+    REQUIRE_THROWS_AS(Ptr(std::allocator_arg, small_arena, "large"), std::invalid_argument);
+    REQUIRE(small_arena.getFirstFreeObject() == nullptr);
+}
@@ -1,5 +1,8 @@
+#include "detail/kernel_sets.hpp"
+
 #include <isl/detail/debug/debug.hpp>
 #include <isl/utf8.hpp>
+#include <random>
 
 TEST_CASE("OneBytesUnicodeConversion", "[UnicodeConversion]") {
     auto test = std::string{};
@@ -28,3 +31,348 @@ TEST_CASE("FourBytesUnicodeConversion", "[UnicodeConversion]") {
     isl::utf8::appendUtf32ToUtf8Container(std::back_inserter(test), U'\U0010FDFE');
     REQUIRE(test == "\U0010FDFE");
 }
+
+TEST_CASE("Utf8SequenceSize", "[UnicodeValidation]") {
+    STATIC_REQUIRE(isl::utf8::size('a') == 1);
+    STATIC_REQUIRE(isl::utf8::size('\x80') == 0);
+    STATIC_REQUIRE(isl::utf8::size('\xC3') == 2);
+    STATIC_REQUIRE(isl::utf8::size('\xE2') == 3);
+    STATIC_REQUIRE(isl::utf8::size('\xF0') == 4);
+    STATIC_REQUIRE(isl::utf8::size('\xF8') == 0);
+    STATIC_REQUIRE(isl::utf8::size('\xFF') == 0);
+}
+
+// Decodes the value of a sequence, so it does not share any logic with the library.
+static auto referenceSequenceSize(const std::string_view str, const std::size_t position)
+    -> std::size_t
+{
+    constexpr auto min_values = std::array<char32_t, 5>{0, 0, 0x80, 0x800, 0x10000};
+
+    const auto lead = static_cast<unsigned char>(str[position]);
+    auto size = std::size_t{};
+    auto value = char32_t{};
+
+    if (lead < 0x80) {
+        return 1;
+    }
+
+    if ((lead & 0xE0U) == 0xC0U) {
+        size = 2;
+        value = lead & 0x1FU;
+    } else if ((lead & 0xF0U) == 0xE0U) {
+        size = 3;
+        value = lead & 0x0FU;
+    } else if ((lead & 0xF8U) == 0xF0U) {
+        size = 4;
+        value = lead & 0x07U;
+    } else {
+        return 0;
+    }
+
+    if (position + size > str.size()) {
+        return 0;
+    }
+
+    for (std::size_t i = 1; i != size; ++i) {
+        const auto byte = static_cast<unsigned char>(str[position + i]);
+
+        if ((byte & 0xC0U) != 0x80U) {
+            return 0;
+        }
+
+        value = (value << 6U) | (byte & 0x3FU);
+    }
+
+    if (value < min_values[size] || value > 0x10FFFF || (value >= 0xD800 && value <= 0xDFFF)) {
+        return 0;
+    }
+
+    return size;
+}
+
+static auto referenceFindFirstInvalid(const std::string_view str) -> std::size_t
+{
+    for (std::size_t position = 0; position != str.size();) {
+        const auto size = referenceSequenceSize(str, position);
+
+        if (size == 0) {
+            return position;
+        }
+
+        position += size;
+    }
+
+    return str.size();
+}
+
+// Valid text with ASCII runs long enough to take the ASCII paths of vector kernels.
+static auto makeRandomUtf8(std::mt19937 &engine, const std::size_t count) -> std::string
+{
+    auto kind_distribution = std::uniform_int_distribution<int>{0, 9};
+    auto result = std::string{};
+
+    for (std::size_t i = 0; i != count; ++i) {
+        auto chr = char32_t{};
+
+        switch (kind_distribution(engine)) {
+        case 0:
+            chr = std::uniform_int_distribution<char32_t>{0x80, 0x7FF}(engine);
+            break;
+
+        case 1:
+            chr = std::uniform_int_distribution<char32_t>{0x800, 0xD7FF}(engine);
+            break;
+
+        case 2:
+            chr = std::uniform_int_distribution<char32_t>{0xE000, 0x10FFFF}(engine);
+            break;
+
+        default:
+            chr = std::uniform_int_distribution<char32_t>{0, 0x7F}(engine);
+            break;
+        }
+
+        isl::utf8::appendUtf32ToUtf8Container(std::back_inserter(result), chr);
+    }
+
+    return result;
+}
+
+TEST_CASE("Utf8ValidationKnownSequences", "[UnicodeValidation]") {
+    forEachKernelSet([] {
+        using isl::utf8::findFirstInvalid;
+
+        for (const std::string_view str :
+             {"", "abc", "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xEF\xBF\xBF",
+              "\xF4\x8F\xBF\xBF", "\xED\x9F\xBF", "\xEE\x80\x80"}) {
+            REQUIRE(isl::utf8::validate(str));
+        }
+
+        REQUIRE(findFirstInvalid(std::string_view{"\x80"}) == 0);
+        REQUIRE(findFirstInvalid(std::string_view{"a\xC0\xAF"}) == 1);
+        REQUIRE(findFirstInvalid(std::string_view{"ab\xC3"}) == 2);
+        REQUIRE(findFirstInvalid(std::string_view{"\xC3\x41"}) == 0);
+        REQUIRE(findFirstInvalid(std::string_view{"\xE0\x80\xAF"}) == 0);
+        REQUIRE(findFirstInvalid(std::string_view{"\xED\xA0\x80"}) == 0);
+        REQUIRE(findFirstInvalid(std::string_view{"\xF0\x8F\xBF\xBF"}) == 0);
+        REQUIRE(findFirstInvalid(std::string_view{"\xF4\x90\x80\x80"}) == 0);
+        REQUIRE(findFirstInvalid(std::string_view{"\xF5\x80\x80\x80"}) == 0);
+        REQUIRE(findFirstInvalid(std::string_view{"\xE2\x82\xAC\xFF"}) == 3);
+        REQUIRE(findFirstInvalid(std::string_view{"\xF0\x9F\x98\x80\x80"}) == 4);
+    });
+}
+
+TEST_CASE("Utf8ValidationRandomBytes", "[UnicodeValidation]") {
+    forEachKernelSet([] {
+        static constexpr auto alphabet = std::string_view{
+            "a \x80\x8F\x90\x9F\xA0\xBF\xC0\xC2\xDF\xE0\xED\xEF\xF0\xF4\xF5\xFF"};
+
+        auto engine = std::mt19937{42};
+        auto distribution = std::uniform_int_distribution<std::size_t>{0, alphabet.size() - 1};
+
+        for (std::size_t length = 0; length != 300; ++length) {
+            for (std::size_t attempt = 0; attempt != 16; ++attempt) {
+                auto str = std::string(length, ' ');
+
+                for (auto &chr : str) {
+                    chr = alphabet[distribution(engine)];
+                }
+
+                REQUIRE(isl::utf8::findFirstInvalid(str) == referenceFindFirstInvalid(str));
+            }
+        }
+    });
+}
+
+TEST_CASE("Utf8ValidationBrokenText", "[UnicodeValidation]") {
+    forEachKernelSet([] {
+        auto engine = std::mt19937{7};
+
+        for (std::size_t count = 0; count != 200; ++count) {
+            const auto text = makeRandomUtf8(engine, count);
+
+            REQUIRE(isl::utf8::validate(text));
+
+            for (std::size_t position = 0; position < text.size(); position += 1 + position / 8) {
+                for (const char replacement :
+                     {'\x80', '\xBF', '\xC0', '\xE0', '\xF0', '\xF4', 'a'}) {
+                    auto broken = text;
+                    broken[position] = replacement;
+
+                    REQUIRE(
+                        isl::utf8::findFirstInvalid(broken) == referenceFindFirstInvalid(broken));
+                }
+
+                const auto truncated = std::string_view{text}.substr(0, position);
+                REQUIRE(
+                    isl::utf8::findFirstInvalid(truncated)
+                    == referenceFindFirstInvalid(truncated));
+            }
+        }
+    });
+}
+
+TEST_CASE("Utf8CountCodePoints", "[UnicodeValidation]") {
+    forEachKernelSet([] {
+        auto engine = std::mt19937{13};
+
+        for (std::size_t count = 0; count != 300; ++count) {
+            const auto text = makeRandomUtf8(engine, count);
+            REQUIRE(isl::utf8::countCodePoints(text) == count);
+        }
+    });
+}
+
+TEST_CASE("Utf8ValidationConstexpr", "[UnicodeValidation]") {
+    STATIC_REQUIRE(isl::utf8::validate(std::string_view{"\xD0\xBF\xD1\x80\xD0\xB8"}));
+    STATIC_REQUIRE(isl::utf8::findFirstInvalid(std::string_view{"ab\xED\xA0\x80"}) == 2);
+    STATIC_REQUIRE(isl::utf8::countCodePoints(std::string_view{"\xD0\xBF\xD1\x80\xD0\xB8"}) == 3);
+}
+
+// Code points of random kinds up to the given one: ASCII, two bytes, three bytes and four bytes
+// long in UTF-8. ASCII characters are more frequent to make runs for vector fast paths.
+static auto makeRandomCodePoints(std::mt19937 &engine, const std::size_t count, const int max_kind)
+    -> std::u32string
+{
+    auto kind_distribution = std::uniform_int_distribution<int>{0, max_kind + 3};
+    auto result = std::u32string{};
+
+    for (std::size_t i = 0; i != count; ++i) {
+        const auto kind = kind_distribution(engine);
+
+        switch (kind > max_kind ? 0 : kind) {
+        case 1:
+            result.push_back(std::uniform_int_distribution<char32_t>{0x80, 0x7FF}(engine));
+            break;
+
+        case 2:
+            result.push_back(std::uniform_int_distribution<char32_t>{0x800, 0xD7FF}(engine));
+            break;
+
+        case 3:
+            result.push_back(std::uniform_int_distribution<char32_t>{0xE000, 0xFFFF}(engine));
+            break;
+
+        case 4:
+            result.push_back(std::uniform_int_distribution<char32_t>{0x10000, 0x10FFFF}(engine));
+            break;
+
+        default:
+            result.push_back(std::uniform_int_distribution<char32_t>{0, 0x7F}(engine));
+            break;
+        }
+    }
+
+    return result;
+}
+
+static auto referenceUtf16(const std::u32string &code_points) -> std::u16string
+{
+    auto result = std::u16string{};
+
+    for (auto chr : code_points) {
+        if (chr < 0x10000) {
+            result.push_back(static_cast<char16_t>(chr));
+            continue;
+        }
+
+        chr -= 0x10000;
+        result.push_back(static_cast<char16_t>(0xD800 + (chr >> 10U)));
+        result.push_back(static_cast<char16_t>(0xDC00 + (chr & 0x3FFU)));
+    }
+
+    return result;
+}
+
+TEST_CASE("Utf8Transcoding", "[UnicodeTranscoding]") {
+    forEachKernelSet([] {
+        auto engine = std::mt19937{42};
+
+        for (int max_kind = 0; max_kind != 5; ++max_kind) {
+            for (std::size_t count = 0; count != 300; ++count) {
+                const auto utf32 = makeRandomCodePoints(engine, count, max_kind);
+                const auto utf16 = referenceUtf16(utf32);
+                auto utf8 = std::string{};
+
+                for (const auto chr : utf32) {
+                    isl::utf8::appendUtf32ToUtf8Container(std::back_inserter(utf8), chr);
+                }
+
+                REQUIRE(isl::utf8::utf32Size(utf8) == utf32.size());
+                REQUIRE(isl::utf8::utf16Size(utf8) == utf16.size());
+                REQUIRE(isl::utf8::encodedSize(utf32) == utf8.size());
+                REQUIRE(isl::utf8::encodedSize(utf16) == utf8.size());
+
+                auto utf32_buffer = std::u32string(utf32.size(), U'\0');
+                auto utf16_buffer = std::u16string(utf16.size(), u'\0');
+                auto utf8_buffer = std::string(utf8.size(), '\0');
+
+                REQUIRE(isl::utf8::decode(utf8, utf32_buffer).size() == utf32.size());
+                REQUIRE(utf32_buffer == utf32);
+
+                REQUIRE(isl::utf8::decode(utf8, utf16_buffer).size() == utf16.size());
+                REQUIRE(utf16_buffer == utf16);
+
+                REQUIRE(isl::utf8::encode(utf32, utf8_buffer).size() == utf8.size());
+                REQUIRE(utf8_buffer == utf8);
+
+                std::ranges::fill(utf8_buffer, '\0');
+                REQUIRE(isl::utf8::encode(utf16, utf8_buffer).size() == utf8.size());
+                REQUIRE(utf8_buffer == utf8);
+            }
+        }
+    });
+}
+
+TEST_CASE("Utf8TranscodingErrors", "[UnicodeTranscoding]") {
+    forEachKernelSet([] {
+        auto utf32_buffer = std::u32string(8, U'\0');
+        auto utf16_buffer = std::u16string(8, u'\0');
+        auto utf8_buffer = std::string(8, '\0');
+
+        REQUIRE_THROWS_AS(
+            isl::utf8::decode(std::string_view{"a\xC0\xAF"}, utf32_buffer), std::invalid_argument);
+        REQUIRE_THROWS_AS(
+            isl::utf8::decode(std::string_view{"\xED\xA0\x80"}, utf16_buffer),
+            std::invalid_argument);
+        REQUIRE_THROWS_AS(
+            isl::utf8::decode(std::string_view{"123456789"}, utf32_buffer), std::length_error);
+        REQUIRE_THROWS_AS(
+            isl::utf8::decode(std::string_view{"1234567\xF0\x9F\x98\x80"}, utf16_buffer),
+            std::length_error);
+
+        REQUIRE_THROWS_AS(
+            isl::utf8::encode(std::u32string_view{U"a\x110000"}, utf8_buffer),
+            std::invalid_argument);
+        REQUIRE_THROWS_AS(
+            isl::utf8::encode(std::u32string{U'a', 0xDC00}, utf8_buffer), std::invalid_argument);
+        REQUIRE_THROWS_AS(
+            isl::utf8::encode(std::u16string{u'a', 0xD800}, utf8_buffer), std::invalid_argument);
+        REQUIRE_THROWS_AS(
+            isl::utf8::encode(std::u16string{0xDC00, u'a'}, utf8_buffer), std::invalid_argument);
+        REQUIRE_THROWS_AS(
+            isl::utf8::encode(std::u32string_view{U"\U0001F600\U0001F600\U0001F600"}, utf8_buffer),
+            std::length_error);
+
+        const auto decoded =
+            isl::utf8::decode<isl::FunctionAPI::UNSAFE>(std::string_view{"\xD0\xBF"}, utf32_buffer);
+        REQUIRE(std::u32string_view{decoded.data(), decoded.size()} == U"п");
+    });
+}
+
+TEST_CASE("Utf8TranscodingConstexpr", "[UnicodeTranscoding]") {
+    STATIC_REQUIRE([] {
+        auto buffer = std::array<char16_t, 4>{};
+        const auto decoded =
+            isl::utf8::decode(std::string_view{"a\xD0\xBF\xF0\x9F\x98\x80"}, buffer);
+
+        return std::u16string_view{decoded.data(), decoded.size()} == u"aп\U0001F600";
+    }());
+
+    STATIC_REQUIRE([] {
+        auto buffer = std::array<char, 8>{};
+        const auto encoded = isl::utf8::encode(std::u32string_view{U"aп\U0001F600"}, buffer);
+
+        return std::string_view{encoded.data(), encoded.size()} == "a\xD0\xBF\xF0\x9F\x98\x80";
+    }());
+}
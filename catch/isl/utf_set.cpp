@@ -1,5 +1,6 @@
 #include <isl/detail/debug/debug.hpp>
 #include <isl/utf_set.hpp>
+#include <random>
 
 // NOLINTBEGIN
 
@@ -54,4 +55,319 @@ TEST_CASE("UtfSetUtfTest", "[UtfSet]")
     }
 }
 
+TEST_CASE("UtfSetRandomRanges", "[UtfSet]")
+{
+    constexpr char32_t max_code_point = 700;
+
+    auto engine = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<char32_t>{0, max_code_point};
+    auto utf_set = isl::UtfSet{};
+    auto reference = std::vector<bool>(max_code_point + 1);
+
+    for (std::size_t i = 0; i != 2000; ++i) {
+        auto first = distribution(engine);
+        auto last = distribution(engine);
+
+        if (first > last) {
+            std::swap(first, last);
+        }
+
+        const auto value = i % 3 != 0;
+        utf_set.set({first, last}, value);
+        std::fill(reference.begin() + first, reference.begin() + last, value);
+
+        for (char32_t chr = 0; chr <= max_code_point; ++chr) {
+            REQUIRE(utf_set.at(chr) == reference[chr]);
+        }
+    }
+}
+
+TEST_CASE("UtfSetIntervals", "[UtfSet]")
+{
+    auto utf_set = isl::UtfSet{{}, {{0x4E00, 0x9FFF + 1}, {0x20000, 0x2A6DF + 1}, {0x80, 0x100}}};
+
+    REQUIRE(utf_set.intervalsCount() == 3);
+    REQUIRE(utf_set.at(0x80));
+    REQUIRE(utf_set.at(0x9FFF));
+    REQUIRE(utf_set.at(0x2A6DF));
+    REQUIRE(!utf_set.at(0x2A6E0));
+    REQUIRE(!utf_set.at(0x10FFFF));
+
+    // touching intervals are merged, erasure in the middle splits the interval
+    utf_set.set({0x100, 0x4E00});
+    REQUIRE(utf_set.intervalsCount() == 2);
+
+    utf_set.set({0x1000, 0x2000}, false);
+    REQUIRE(utf_set.intervalsCount() == 3);
+    REQUIRE(utf_set.at(0xFFF));
+    REQUIRE(!utf_set.at(0x1000));
+    REQUIRE(!utf_set.at(0x1FFF));
+    REQUIRE(utf_set.at(0x2000));
+
+    utf_set.set({0x80, 0x110000}, false);
+    REQUIRE(utf_set.empty());
+
+    const auto from_symbols = isl::UtfSet{{}, {0x400, 0x401, 0x402, 0x500}};
+    REQUIRE(from_symbols.intervalsCount() == 2);
+    REQUIRE(from_symbols.at(0x402));
+    REQUIRE(!from_symbols.at(0x403));
+}
+
+TEST_CASE("UtfSetPagesFollowBoundaries", "[UtfSet]")
+{
+    constexpr char32_t max_code_point = 0x12000;
+
+    auto engine = std::mt19937{11};
+    auto distribution = std::uniform_int_distribution<char32_t>{0x80, max_code_point};
+    auto utf_set = isl::UtfSet{};
+    auto reference = std::vector<bool>(max_code_point + 1);
+
+    // ranges far apart grow and shrink the page table in both directions
+    for (std::size_t i = 0; i != 300; ++i) {
+        const auto first = distribution(engine);
+        const auto last = std::min<char32_t>(first + distribution(engine) % 300, max_code_point);
+        const auto value = i % 4 != 0;
+
+        utf_set.set(isl::Range<char32_t>{first, last}, value);
+        std::fill(reference.begin() + first, reference.begin() + last, value);
+
+        for (char32_t chr = 0x80; chr <= max_code_point; chr += 7) {
+            REQUIRE(utf_set.at(chr) == reference[chr]);
+        }
+    }
+}
+
+static auto makeRandomSet(std::mt19937 &engine, const char32_t max_code_point) -> isl::UtfSet
+{
+    auto distribution = std::uniform_int_distribution<char32_t>{0, max_code_point};
+    auto utf_set = isl::UtfSet{};
+
+    for (std::size_t i = 0; i != 20; ++i) {
+        const auto first = distribution(engine);
+        const auto last = std::min<char32_t>(first + distribution(engine) / 8, max_code_point);
+        utf_set.set(isl::Range<char32_t>{first, last});
+    }
+
+    return utf_set;
+}
+
+TEST_CASE("UtfSetAlgebra", "[UtfSet]")
+{
+    constexpr char32_t max_code_point = 1000;
+
+    auto engine = std::mt19937{7};
+
+    for (std::size_t i = 0; i != 100; ++i) {
+        const auto lhs = makeRandomSet(engine, max_code_point);
+        const auto rhs = makeRandomSet(engine, max_code_point);
+        const auto united = lhs | rhs;
+        const auto intersected = lhs & rhs;
+        const auto subtracted = lhs - rhs;
+        const auto complement = ~lhs;
+
+        for (char32_t chr = 0; chr <= max_code_point; ++chr) {
+            REQUIRE(united.at(chr) == (lhs.at(chr) || rhs.at(chr)));
+            REQUIRE(intersected.at(chr) == (lhs.at(chr) && rhs.at(chr)));
+            REQUIRE(subtracted.at(chr) == (lhs.at(chr) && !rhs.at(chr)));
+            REQUIRE(complement.at(chr) == !lhs.at(chr));
+        }
+
+        REQUIRE(complement.at(0x10FFFF));
+        REQUIRE(!complement.at(0x110000));
+        REQUIRE(~complement == lhs);
+        REQUIRE((lhs - lhs).empty());
+
+        auto assigned = lhs;
+        assigned |= rhs;
+        REQUIRE(assigned == united);
+
+        assigned &= lhs;
+        REQUIRE(assigned == lhs);
+
+        assigned -= rhs;
+        REQUIRE(assigned == subtracted);
+    }
+
+    // results are built from merged intervals
+    using Ranges = std::vector<isl::Range<char32_t>>;
+
+    const auto lhs = isl::UtfSet{{}, Ranges{{0x400, 0x410}}};
+    const auto rhs = isl::UtfSet{{}, Ranges{{0x410, 0x420}}};
+    REQUIRE((lhs | rhs).intervalsCount() == 1);
+    REQUIRE((lhs | rhs) == isl::UtfSet{{}, Ranges{{0x400, 0x420}}});
+}
+
+TEST_CASE("UtfSetClassify", "[UtfSet]")
+{
+    auto engine = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<char32_t>{0, 0x500};
+    auto utf_set = makeRandomSet(engine, 0x500);
+
+    utf_set.set({'a', 'z' + 1});
+    utf_set.set('_');
+
+    for (const auto size : std::to_array<std::size_t>({0, 1, 63, 64, 65, 200})) {
+        auto chars = std::vector<char32_t>(size);
+        auto bits = std::vector<isl::u64>((size + 63) / 64, ~isl::u64{});
+
+        for (auto &chr : chars) {
+            chr = distribution(engine);
+        }
+
+        if (size > 1) {
+            chars.back() = 0x110000 + distribution(engine);
+        }
+
+        utf_set.classify(chars, bits);
+
+        for (std::size_t i = 0; i != size; ++i) {
+            const auto bit = (bits[i / 64] >> (i % 64)) & 1U;
+            REQUIRE(bit == static_cast<isl::u64>(utf_set.at(chars[i])));
+        }
+
+        for (std::size_t i = size; i != bits.size() * 64; ++i) {
+            REQUIRE(((bits[i / 64] >> (i % 64)) & 1U) == 0);
+        }
+    }
+
+    auto chars = std::vector<char32_t>(65);
+    auto bits = std::vector<isl::u64>(1);
+    REQUIRE_THROWS_AS(utf_set.classify(chars, bits), std::length_error);
+}
+
+TEST_CASE("UtfSetSpanWhile", "[UtfSet]")
+{
+    auto identifier = isl::UtfSet{};
+    identifier.set({'a', 'z' + 1});
+    identifier.set({'0', '9' + 1});
+    identifier.set('_');
+    identifier.set({U'а', U'я' + 1});
+    identifier.set(U'😀');
+
+    REQUIRE(identifier.spanWhile("") == 0);
+    REQUIRE(identifier.spanWhile("abc_42 + 1") == 6);
+    REQUIRE(identifier.spanWhile("переменная = 1") == 20);
+    REQUIRE(identifier.spanWhile("имя_var😀") == 14);
+    REQUIRE(identifier.spanWhile("ab語") == 2);
+    REQUIRE(identifier.spanWhile("abя\xFF") == 4);
+    REQUIRE(identifier.spanWhile("ab\xD1") == 2);
+    REQUIRE(identifier.spanWhile("\xD0\xB0\xB0") == 2);
+
+    auto engine = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<int>{0, 9};
+
+    for (std::size_t size = 0; size != 300; ++size) {
+        auto text = std::string{};
+
+        for (std::size_t i = 0; i != size; ++i) {
+            // the mix is mostly identifier characters, so long prefixes are checked
+            switch (distribution(engine)) {
+            case 0:
+                text += "語";
+                break;
+            case 1:
+                text += "\xFF";
+                break;
+            case 2:
+            case 3:
+                text += "ж";
+                break;
+            default:
+                text += static_cast<char>('a' + i % 26);
+                break;
+            }
+        }
+
+        auto expected = std::size_t{};
+
+        for (const auto chr : isl::string_view{text}.codepoints()) {
+            if (!identifier.at(chr)) {
+                break;
+            }
+
+            expected += chr < 0x80 ? 1 : 2;
+        }
+
+        REQUIRE(identifier.spanWhile(text) == expected);
+    }
+}
+
+using CodePoints = isl::Range<char32_t>;
+
+static constexpr auto Identifier = isl::StaticUtfSet{{
+    CodePoints{'a', 'z' + 1},
+    CodePoints{'A', 'Z' + 1},
+    CodePoints{'0', '9' + 1},
+    CodePoints{'_', '_' + 1},
+    CodePoints{U'а', U'я' + 1},
+    CodePoints{U'ё', U'ё' + 1},
+    CodePoints{0x4E00, 0xA000},
+    CodePoints{0x20000, 0x2A6E0},
+}};
+
+template<isl::StaticUtfSet Set>
+constexpr auto countInSet(const std::u32string_view str) -> std::size_t
+{
+    return static_cast<std::size_t>(std::ranges::count_if(str, [](const char32_t chr) {
+        return Set.at(chr);
+    }));
+}
+
+TEST_CASE("StaticUtfSet", "[UtfSet]")
+{
+    STATIC_REQUIRE(Identifier.at('a'));
+    STATIC_REQUIRE(Identifier.at('_'));
+    STATIC_REQUIRE(!Identifier.at(' '));
+    STATIC_REQUIRE(Identifier.at(U'ж'));
+    STATIC_REQUIRE(Identifier.at(0x9FFF));
+    STATIC_REQUIRE(!Identifier.at(0xA000));
+    STATIC_REQUIRE(!Identifier.at(0x110000));
+    STATIC_REQUIRE(Identifier.intervalsCount() == 4);
+    STATIC_REQUIRE(countInSet<Identifier>(U"имя_1 + 語") == 6);
+
+    // unsorted and touching ranges are merged
+    STATIC_REQUIRE(isl::makeStaticUtfSet({
+                                             CodePoints{0x410, 0x420},
+                                             CodePoints{0x400, 0x410},
+                                             CodePoints{0x405, 0x408},
+                                         })
+                       .intervalsCount()
+                   == 1);
+
+    STATIC_REQUIRE(isl::makeStaticUtfSet({CodePoints{'a', 'b'}}).intervalsCount() == 0);
+    STATIC_REQUIRE(!isl::makeStaticUtfSet({CodePoints{'a', 'a'}}).at('a'));
+    STATIC_REQUIRE(isl::makeStaticUtfSet({CodePoints{'a', 'a'}}).empty());
+
+    const auto dynamic = isl::UtfSet{
+        {},
+        {
+            {'a', 'z' + 1},
+            {'A', 'Z' + 1},
+            {'0', '9' + 1},
+            {'_', '_' + 1},
+            {U'а', U'я' + 1},
+            {U'ё', U'ё' + 1},
+            {0x4E00, 0xA000},
+            {0x20000, 0x2A6E0},
+        }};
+
+    auto chars = std::vector<char32_t>{};
+
+    for (char32_t chr = 0; chr != 0x30000; ++chr) {
+        REQUIRE(Identifier.at(chr) == dynamic.at(chr));
+        chars.push_back(chr);
+    }
+
+    auto static_bits = std::vector<isl::u64>((chars.size() + 63) / 64);
+    auto dynamic_bits = static_bits;
+
+    Identifier.classify(chars, static_bits);
+    dynamic.classify(chars, dynamic_bits);
+    REQUIRE(static_bits == dynamic_bits);
+
+    for (const auto *str : {"", "abc_42 + 1", "переменная = 1", "ab語x!", "abя\xFF"}) {
+        REQUIRE(Identifier.spanWhile(str) == dynamic.spanWhile(str));
+    }
+}
+
 // NOLINTEND
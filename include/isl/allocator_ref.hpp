@@ -0,0 +1,168 @@
+#ifndef ISL_PROJECT_ALLOCATOR_REF_HPP
+#define ISL_PROJECT_ALLOCATOR_REF_HPP
+
+#include <isl/isl.hpp>
+#include <limits>
+
+namespace isl
+{
+    namespace detail
+    {
+        // Object pools hand out constructed objects and take them back without destruction.
+        template <typename Allocator>
+        ISL_DECL auto keepsObjectsConstructed() noexcept -> bool
+        {
+            if constexpr (requires { Allocator::keepsObjectsConstructed; }) {
+                return Allocator::keepsObjectsConstructed;
+            } else {
+                return false;
+            }
+        }
+    } // namespace detail
+
+    // Empty handle for allocators known at compile time, costs nothing inside smart pointers.
+    template <auto AllocatorPtr>
+    struct StaticAllocatorRef
+    {
+        template <typename T>
+        ISL_DECL static auto canAllocate() noexcept -> bool
+        {
+            return AllocatorPtr->template canAllocate<T>();
+        }
+
+        ISL_DECL static auto keepsObjectsConstructed() noexcept -> bool
+        {
+            return detail::keepsObjectsConstructed<
+                std::remove_cvref_t<decltype(*AllocatorPtr)>>();
+        }
+
+        [[nodiscard]] static auto allocate() -> void *
+        {
+            return AllocatorPtr->allocate();
+        }
+
+        static auto deallocate(void *ptr) -> void
+        {
+            AllocatorPtr->deallocate(ptr);
+        }
+
+        [[nodiscard]] auto operator==(const StaticAllocatorRef &) const noexcept -> bool = default;
+    };
+
+    // Type-erased reference to an allocator that lives somewhere at runtime (an arena, a
+    // per-connection or a thread-local pool). It is two pointers: the allocator itself and a
+    // static table of operations shared by all references to allocators of the same type.
+    class AllocatorRef
+    {
+    private:
+        struct Operations
+        {
+            void *(*allocate)(void *allocator);
+            void (*deallocate)(void *allocator, void *ptr);
+            std::size_t maxObjectSize;
+            std::size_t alignment;
+            bool keepsObjectsConstructed;
+        };
+
+        template <typename Allocator>
+        ISL_DECL static auto getMaxObjectSize() noexcept -> std::size_t
+        {
+            if constexpr (requires { Allocator::getMaxObjectSize(); }) {
+                return Allocator::getMaxObjectSize();
+            } else {
+                return std::numeric_limits<std::size_t>::max();
+            }
+        }
+
+        template <typename Allocator>
+        ISL_DECL static auto getAlignment() noexcept -> std::size_t
+        {
+            if constexpr (requires { Allocator::getAllocationAlignment(); }) {
+                return Allocator::getAllocationAlignment();
+            } else {
+                return alignof(std::max_align_t);
+            }
+        }
+
+        template <typename Allocator>
+        static constexpr auto OperationsFor = Operations{
+            .allocate = [](void *allocator) -> void * {
+                return static_cast<Allocator *>(allocator)->allocate();
+            },
+            .deallocate = [](void *allocator,
+                             void *ptr) { static_cast<Allocator *>(allocator)->deallocate(ptr); },
+            .maxObjectSize = getMaxObjectSize<Allocator>(),
+            .alignment = getAlignment<Allocator>(),
+            .keepsObjectsConstructed = detail::keepsObjectsConstructed<Allocator>(),
+        };
+
+        void *allocator{};
+        const Operations *operations{};
+
+    public:
+        AllocatorRef() = default;
+
+        template <typename Allocator>
+        requires(!std::same_as<std::remove_cv_t<Allocator>, AllocatorRef>) // NOLINTNEXTLINE
+        constexpr AllocatorRef(Allocator &allocator_object ISL_LIFETIMEBOUND) noexcept
+          : allocator{std::addressof(allocator_object)}
+          , operations{std::addressof(OperationsFor<Allocator>)}
+        {}
+
+        template <typename T>
+        [[nodiscard]] auto canAllocate() const noexcept -> bool
+        {
+            return std::is_abstract_v<T>
+                   || (sizeof(T) <= operations->maxObjectSize
+                       && alignof(T) <= operations->alignment);
+        }
+
+        [[nodiscard]] auto keepsObjectsConstructed() const noexcept -> bool
+        {
+            return operations->keepsObjectsConstructed;
+        }
+
+        [[nodiscard]] auto allocate() const -> void *
+        {
+            return operations->allocate(allocator);
+        }
+
+        auto deallocate(void *ptr) const -> void
+        {
+            operations->deallocate(allocator, ptr);
+        }
+
+        [[nodiscard]] auto get() const noexcept -> void *
+        {
+            return allocator;
+        }
+
+        [[nodiscard]] auto operator==(const AllocatorRef &other) const noexcept -> bool
+        {
+            return allocator == other.allocator;
+        }
+    };
+
+    // Passing &isl::RuntimeAllocator instead of a global allocator makes smart pointers take
+    // an AllocatorRef at construction time.
+    struct RuntimeAllocatorTag
+    {
+        template <typename T>
+        ISL_DECL static auto canAllocate() noexcept -> bool
+        {
+            return true;
+        }
+    };
+
+    inline constexpr auto RuntimeAllocator = RuntimeAllocatorTag{};
+
+    template <auto AllocatorPtr>
+    constexpr inline bool IsRuntimeAllocator =
+        std::same_as<decltype(AllocatorPtr), const RuntimeAllocatorTag *>;
+
+    template <auto AllocatorPtr>
+    using AllocatorRefFor = std::conditional_t<
+        IsRuntimeAllocator<AllocatorPtr>, AllocatorRef, StaticAllocatorRef<AllocatorPtr>>;
+} // namespace isl
+
+#endif /* ISL_PROJECT_ALLOCATOR_REF_HPP */
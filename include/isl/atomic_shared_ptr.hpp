@@ -0,0 +1,168 @@
+#ifndef ISL_PROJECT_ATOMIC_SHARED_PTR_HPP
+#define ISL_PROJECT_ATOMIC_SHARED_PTR_HPP
+
+#include <isl/memory.hpp>
+#include <isl/thread/hazard_pointer.hpp>
+#include <mutex>
+
+namespace isl
+{
+    // Slot for read-mostly snapshots. The slot owns one strong reference to the current
+    // frame. Readers protect the frame with a hazard pointer, so read() never writes to
+    // shared memory and load() only increments the frame's counter. Replaced frames are
+    // retired and their reference is dropped once no hazard points to them.
+    template <typename T, typename Frame, auto AllocatorPtr>
+    requires(Frame::refCountPolicy != RefCountPolicy::SINGLE_THREADED)
+    class AtomicSharedPtr
+    {
+    public:
+        using SharedPtrType = SharedPtr<T, Frame, AllocatorPtr>;
+
+        class Snapshot
+        {
+        private:
+            thread::HazardGuard guard;
+            Frame *frame{};
+
+        public:
+            explicit Snapshot(const std::atomic<Frame *> &source)
+              : frame{guard.protect(source)}
+            {}
+
+            [[nodiscard]] explicit operator bool() const noexcept
+            {
+                return frame != nullptr;
+            }
+
+            [[nodiscard]] auto get() const noexcept -> const T *
+            {
+                if (frame == nullptr) {
+                    return nullptr;
+                }
+
+                return frame->template asPtr<T>();
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> const T &
+            {
+                return *get();
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> const T *
+            {
+                return get();
+            }
+        };
+
+    private:
+        std::atomic<Frame *> frame{};
+        std::mutex retiredLock;
+        std::vector<Frame *> retired;
+
+    public:
+        AtomicSharedPtr() = default;
+
+        explicit AtomicSharedPtr(SharedPtrType ptr) noexcept
+          : frame{ptr.releaseFrame()}
+        {}
+
+        AtomicSharedPtr(const AtomicSharedPtr &) = delete;
+        AtomicSharedPtr(AtomicSharedPtr &&) = delete;
+
+        ~AtomicSharedPtr()
+        {
+            // there must be no readers left at this point
+            releaseReference(frame.load(std::memory_order_acquire));
+
+            for (auto *retired_frame : retired) {
+                releaseReference(retired_frame);
+            }
+        }
+
+        auto operator=(const AtomicSharedPtr &) -> AtomicSharedPtr & = delete;
+        auto operator=(AtomicSharedPtr &&) -> AtomicSharedPtr & = delete;
+
+        [[nodiscard]] static constexpr auto isLockFree() noexcept -> bool
+        {
+            return std::atomic<Frame *>::is_always_lock_free;
+        }
+
+        [[nodiscard]] auto read() const -> Snapshot
+        {
+            return Snapshot{frame};
+        }
+
+        [[nodiscard]] auto load() const -> SharedPtrType
+        {
+            auto guard = thread::HazardGuard{};
+            auto *current = guard.protect(frame);
+
+            if (current == nullptr) {
+                return nullptr;
+            }
+
+            return SharedPtrType{FrameCopyT{}, current};
+        }
+
+        auto store(SharedPtrType desired) -> void
+        {
+            retire(frame.exchange(desired.releaseFrame(), std::memory_order_seq_cst));
+        }
+
+        // The caller gets its own reference, the one owned by the slot is retired as usual.
+        auto exchange(SharedPtrType desired) -> SharedPtrType
+        {
+            auto *old_frame = frame.exchange(desired.releaseFrame(), std::memory_order_seq_cst);
+
+            if (old_frame == nullptr) {
+                return nullptr;
+            }
+
+            auto result = SharedPtrType{FrameCopyT{}, old_frame};
+            retire(old_frame);
+
+            return result;
+        }
+
+        // Drops retired references which are not protected by any reader.
+        auto collectRetired() -> void
+        {
+            const auto lock = std::scoped_lock{retiredLock};
+            collectRetiredUnlocked();
+        }
+
+    private:
+        auto retire(Frame *old_frame) -> void
+        {
+            if (old_frame == nullptr) {
+                return;
+            }
+
+            const auto lock = std::scoped_lock{retiredLock};
+
+            retired.emplace_back(old_frame);
+            collectRetiredUnlocked();
+        }
+
+        auto collectRetiredUnlocked() -> void
+        {
+            std::erase_if(retired, [](Frame *retired_frame) {
+                if (thread::isHazardous(retired_frame)) {
+                    return false;
+                }
+
+                releaseReference(retired_frame);
+                return true;
+            });
+        }
+
+        static auto releaseReference(Frame *released_frame) -> void
+        {
+            if (released_frame != nullptr) {
+                [[maybe_unused]] const auto ptr = SharedPtrType{FrameMovedT{}, released_frame};
+            }
+        }
+    };
+} // namespace isl
+
+#endif /* ISL_PROJECT_ATOMIC_SHARED_PTR_HPP */
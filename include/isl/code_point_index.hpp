@@ -0,0 +1,144 @@
+#ifndef ISL_PROJECT_CODE_POINT_INDEX_HPP
+#define ISL_PROJECT_CODE_POINT_INDEX_HPP
+
+#include <bit>
+#include <cstring>
+#include <isl/string_view.hpp>
+#include <vector>
+
+namespace isl
+{
+    // Byte offsets of every 64th code point of a UTF-8 string. Random access walks at most 63
+    // code points from the closest checkpoint, so the index is built once for repeated access
+    // into large strings. Code points are counted like BasicStringView::codepoints counts them.
+    template<Utf8Character CharT>
+    class CodePointIndex
+    {
+    private:
+        static constexpr std::size_t step = 64;
+        static constexpr auto npos = BasicStringView<CharT>::npos;
+
+        BasicStringView<CharT> string;
+        std::vector<std::size_t> checkpoints;
+        std::size_t codePointsCount{};
+
+    public:
+        explicit CodePointIndex(const BasicStringView<CharT> str)
+          : string{str}
+        {
+            checkpoints.reserve(string.size() / step + 1);
+
+            // the first byte starts a code point even if it is a continuation byte
+            if (!string.empty()) {
+                addCodePoint(0);
+            }
+
+            const auto *bytes = reinterpret_cast<const char *>(string.data());// NOLINT
+            auto index = std::size_t{1};
+
+            // words without checkpoints are counted at once
+            for (; index + sizeof(u64) <= string.size(); index += sizeof(u64)) {
+                const auto lead_bytes = countLeadBytes(bytes + index);
+                const auto till_checkpoint = (step - codePointsCount % step) % step;
+
+                if (lead_bytes <= till_checkpoint) {
+                    codePointsCount += lead_bytes;
+                    continue;
+                }
+
+                for (std::size_t i = index; i != index + sizeof(u64); ++i) {
+                    addCodePointIfLead(bytes, i);
+                }
+            }
+
+            for (; index < string.size(); ++index) {
+                addCodePointIfLead(bytes, index);
+            }
+        }
+
+        [[nodiscard]] auto size() const noexcept -> std::size_t
+        {
+            return codePointsCount;
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> bool
+        {
+            return size() == 0;
+        }
+
+        [[nodiscard]] auto str() const noexcept -> BasicStringView<CharT>
+        {
+            return string;
+        }
+
+        // Returns byte offset of the code point or size of the string if there is no such code
+        // point.
+        [[nodiscard]] auto offsetOf(const std::size_t index) const noexcept -> std::size_t
+        {
+            if (index >= codePointsCount) {
+                return string.size();
+            }
+
+            return string.codePointOffset(index % step, checkpoints[index / step]);
+        }
+
+        // Same as BasicStringView::codePointSubstr, but in constant time.
+        [[nodiscard]] auto substr(std::size_t first, const std::size_t len = npos) const noexcept
+            -> BasicStringView<CharT>
+        {
+            first = std::min(first, codePointsCount);
+            const auto last = first + std::min(len, codePointsCount - first);
+
+            return {string.begin() + offsetOf(first), string.begin() + offsetOf(last)};
+        }
+
+        [[nodiscard]] auto at(const std::size_t index) const -> char32_t
+        {
+            if (index >= codePointsCount) {
+                throw std::out_of_range{
+                    fmt::format("CodePointIndex::at index {} is out of range", index)};
+            }
+
+            return string.substr(offsetOf(index)).codepoints().front();
+        }
+
+        [[nodiscard]] auto operator[](const std::size_t index) const -> char32_t
+        {
+            return at(index);
+        }
+
+    private:
+        auto addCodePoint(const std::size_t offset) -> void
+        {
+            if (codePointsCount % step == 0) {
+                checkpoints.emplace_back(offset);
+            }
+
+            ++codePointsCount;
+        }
+
+        auto addCodePointIfLead(const char *bytes, const std::size_t offset) -> void
+        {
+            if (!utf8::isTrailingCharacter(bytes[offset])) {
+                addCodePoint(offset);
+            }
+        }
+
+        static auto countLeadBytes(const char *bytes) noexcept -> std::size_t
+        {
+            constexpr auto high_bits = u64{0x8080'8080'8080'8080};
+
+            auto word = u64{};
+            std::memcpy(&word, bytes, sizeof(word));
+
+            // continuation bytes have the highest bit set and the next one cleared
+            const auto continuation_bytes = word & ~(word << 1U) & high_bits;
+            return sizeof(u64) - as<std::size_t>(std::popcount(continuation_bytes));
+        }
+    };
+
+    template<Utf8Character CharT>
+    CodePointIndex(BasicStringView<CharT>) -> CodePointIndex<CharT>;
+}// namespace isl
+
+#endif /* ISL_PROJECT_CODE_POINT_INDEX_HPP */
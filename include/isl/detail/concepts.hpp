@@ -36,6 +36,12 @@ namespace isl
     template<typename T, typename U>
     concept RangeOf = std::ranges::range<T> && std::same_as<std::ranges::range_value_t<T>, U>;
 
+    // Objects of such types can be moved to another address with memcpy, after which the
+    // source is treated as destroyed. Specialize for relocatable types with non-trivial
+    // special members (unique pointers, for example).
+    template<typename T>
+    constexpr inline bool IsTriviallyRelocatable = std::is_trivially_copyable_v<T>;
+
     template<typename T, auto C>
     concept RangeOver = std::ranges::range<T> &&
                         requires { C.template operator()<std::ranges::range_value_t<T>>(); };
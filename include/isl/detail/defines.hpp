@@ -53,8 +53,10 @@
 
 #if defined(_MSC_VER)
 #    define ISL_INLINE __forceinline
+#    define ISL_NOINLINE __declspec(noinline)
 #else
 #    define ISL_INLINE __attribute__((always_inline)) inline
+#    define ISL_NOINLINE __attribute__((noinline))
 #endif
 
 #if defined(__clang__)
@@ -81,6 +83,12 @@
 #    define ISL_PREFETCH(ADDR)
 #endif
 
+#if defined(_MSC_VER) && !defined(__clang__)
+#    define ISL_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#    define ISL_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 #if defined(_MSC_VER) && !defined(__clang__)
 #    define ISL_LIFETIMEBOUND [[msvc::lifetimebound]]
 #elif defined(__clang__)
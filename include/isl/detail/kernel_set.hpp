@@ -0,0 +1,20 @@
+#ifndef ISL_PROJECT_KERNEL_SET_HPP
+#define ISL_PROJECT_KERNEL_SET_HPP
+
+#include <isl/detail/types.hpp>
+
+namespace isl::detail
+{
+    // Instruction sets of kernels selected at runtime. DETECTED stands for the best set the CPU
+    // supports.
+    enum class KernelSet : u8
+    {
+        DETECTED,
+        AVX2,
+        SSE2,
+        NEON,
+        SCALAR,
+    };
+}// namespace isl::detail
+
+#endif /* ISL_PROJECT_KERNEL_SET_HPP */
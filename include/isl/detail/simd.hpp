@@ -0,0 +1,213 @@
+#ifndef ISL_PROJECT_SIMD_HPP
+#define ISL_PROJECT_SIMD_HPP
+
+#include <bit>
+#include <isl/detail/concepts.hpp>
+#include <isl/detail/types.hpp>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#    include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#endif
+
+namespace isl::detail::simd
+{
+    template<std::size_t Size>
+    using UnsignedOfSize = std::conditional_t<
+        Size == 1, u8, std::conditional_t<Size == 2, u16, std::conditional_t<Size == 4, u32, u64>>>;
+
+    // Types compared by value bits, so a whole vector of them can be compared at once.
+    template<typename T>
+    concept EqualityScannable = (std::integral<T> || std::is_enum_v<T>)
+                                && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4
+                                    || sizeof(T) == 8);
+
+    template<EqualityScannable T>
+    ISL_DECL auto toBits(const T value) noexcept -> UnsignedOfSize<sizeof(T)>
+    {
+        return std::bit_cast<UnsignedOfSize<sizeof(T)>>(value);
+    }
+
+    template<EqualityScannable T>
+    ISL_DECL auto findEqualScalar(
+        const T *data, const std::size_t first, const std::size_t count, const T value) noexcept
+        -> std::size_t
+    {
+        for (std::size_t i = first; i != count; ++i) {
+            if (data[i] == value) {
+                return i;
+            }
+        }
+
+        return count;
+    }
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#    if defined(__AVX2__)
+    using Vector = __m256i;
+
+    ISL_INLINE auto load(const void *data) noexcept -> Vector
+    {
+        return _mm256_loadu_si256(static_cast<const Vector *>(data));
+    }
+
+    template<std::size_t Size>
+    ISL_INLINE auto broadcast(const UnsignedOfSize<Size> bits) noexcept -> Vector
+    {
+        if constexpr (Size == 1) {
+            return _mm256_set1_epi8(std::bit_cast<char>(bits));
+        } else if constexpr (Size == 2) {
+            return _mm256_set1_epi16(std::bit_cast<short>(bits));
+        } else if constexpr (Size == 4) {
+            return _mm256_set1_epi32(std::bit_cast<int>(bits));
+        } else {
+            return _mm256_set1_epi64x(std::bit_cast<long long>(bits));
+        }
+    }
+
+    // Returns mask with one bit per byte, every byte of equal lanes is set.
+    template<std::size_t Size>
+    ISL_INLINE auto equalMask(const Vector lhs, const Vector rhs) noexcept -> u32
+    {
+        if constexpr (Size == 1) {
+            return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)));
+        } else if constexpr (Size == 2) {
+            return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(lhs, rhs)));
+        } else if constexpr (Size == 4) {
+            return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(lhs, rhs)));
+        } else {
+            return static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(lhs, rhs)));
+        }
+    }
+#    else
+    using Vector = __m128i;
+
+    ISL_INLINE auto load(const void *data) noexcept -> Vector
+    {
+        return _mm_loadu_si128(static_cast<const Vector *>(data));
+    }
+
+    template<std::size_t Size>
+    ISL_INLINE auto broadcast(const UnsignedOfSize<Size> bits) noexcept -> Vector
+    {
+        if constexpr (Size == 1) {
+            return _mm_set1_epi8(std::bit_cast<char>(bits));
+        } else if constexpr (Size == 2) {
+            return _mm_set1_epi16(std::bit_cast<short>(bits));
+        } else if constexpr (Size == 4) {
+            return _mm_set1_epi32(std::bit_cast<int>(bits));
+        } else {
+            return _mm_set1_epi64x(std::bit_cast<long long>(bits));
+        }
+    }
+
+    template<std::size_t Size>
+    ISL_INLINE auto equalMask(const Vector lhs, const Vector rhs) noexcept -> u32
+    {
+        if constexpr (Size == 1) {
+            return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(lhs, rhs)));
+        } else if constexpr (Size == 2) {
+            return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi16(lhs, rhs)));
+        } else if constexpr (Size == 4) {
+            return static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi32(lhs, rhs)));
+        } else {
+            // SSE2 has no 64-bit compare, both 32-bit halves of a lane must be equal
+            const auto equal_halves = _mm_cmpeq_epi32(lhs, rhs);
+            const auto swapped_halves = _mm_shuffle_epi32(equal_halves, _MM_SHUFFLE(2, 3, 0, 1));
+
+            return static_cast<u32>(_mm_movemask_epi8(_mm_and_si128(equal_halves, swapped_halves)));
+        }
+    }
+#    endif
+
+    inline constexpr std::size_t BitsPerByteInMask = 1;
+
+#    define ISL_SIMD_ENABLED 1
+#elif defined(__ARM_NEON)
+    using Vector = uint8x16_t;
+
+    ISL_INLINE auto load(const void *data) noexcept -> Vector
+    {
+        return vld1q_u8(static_cast<const u8 *>(data));
+    }
+
+    template<std::size_t Size>
+    ISL_INLINE auto broadcast(const UnsignedOfSize<Size> bits) noexcept -> Vector
+    {
+        if constexpr (Size == 1) {
+            return vdupq_n_u8(bits);
+        } else if constexpr (Size == 2) {
+            return vreinterpretq_u8_u16(vdupq_n_u16(bits));
+        } else if constexpr (Size == 4) {
+            return vreinterpretq_u8_u32(vdupq_n_u32(bits));
+        } else {
+            return vreinterpretq_u8_u64(vdupq_n_u64(bits));
+        }
+    }
+
+    // NEON has no movemask, narrowing shift packs every byte of the comparison into 4 bits
+    template<std::size_t Size>
+    ISL_INLINE auto equalMask(const Vector lhs, const Vector rhs) noexcept -> u64
+    {
+        auto equal = uint8x16_t{};
+
+        if constexpr (Size == 1) {
+            equal = vceqq_u8(lhs, rhs);
+        } else if constexpr (Size == 2) {
+            equal = vreinterpretq_u8_u16(
+                vceqq_u16(vreinterpretq_u16_u8(lhs), vreinterpretq_u16_u8(rhs)));
+        } else if constexpr (Size == 4) {
+            equal = vreinterpretq_u8_u32(
+                vceqq_u32(vreinterpretq_u32_u8(lhs), vreinterpretq_u32_u8(rhs)));
+        } else {
+            equal = vreinterpretq_u8_u64(
+                vceqq_u64(vreinterpretq_u64_u8(lhs), vreinterpretq_u64_u8(rhs)));
+        }
+
+        const auto narrowed = vshrn_n_u16(vreinterpretq_u16_u8(equal), 4);
+        return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+    }
+
+    inline constexpr std::size_t BitsPerByteInMask = 4;
+
+#    define ISL_SIMD_ENABLED 1
+#else
+#    define ISL_SIMD_ENABLED 0
+#endif
+
+    // Returns index of the first element equal to value or count if there is no such element.
+    template<EqualityScannable T>
+    ISL_DECL auto findEqual(const T *data, const std::size_t count, const T value) noexcept
+        -> std::size_t
+    {
+#if ISL_SIMD_ENABLED
+        if ISL_COMPILE_TIME_BRANCH {
+            return findEqualScalar(data, 0, count, value);
+        } else {
+            constexpr auto elements_in_vector = sizeof(Vector) / sizeof(T);
+
+            const auto needle = broadcast<sizeof(T)>(toBits(value));
+            auto index = std::size_t{};
+
+            for (; index + elements_in_vector <= count; index += elements_in_vector) {
+                const auto mask = equalMask<sizeof(T)>(load(data + index), needle);
+
+                if (mask != 0) {
+                    const auto first_byte =
+                        static_cast<std::size_t>(std::countr_zero(mask)) / BitsPerByteInMask;
+                    return index + first_byte / sizeof(T);
+                }
+            }
+
+            return findEqualScalar(data, index, count, value);
+        }
+#else
+        return findEqualScalar(data, 0, count, value);
+#endif
+    }
+}// namespace isl::detail::simd
+
+#endif /* ISL_PROJECT_SIMD_HPP */
@@ -0,0 +1,76 @@
+#ifndef ISL_PROJECT_SIMD_DISPATCH_HPP
+#define ISL_PROJECT_SIMD_DISPATCH_HPP
+
+#include <array>
+#include <isl/detail/defines.hpp>
+
+// Instruction sets and helpers for kernels selected at runtime. Only sources of the library
+// include this header, public headers declare the kernels with plain pointers.
+#if defined(__x86_64__) || defined(_M_X64)
+#    define ISL_SIMD_X86 1
+#    include <immintrin.h>
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#    endif
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#    define ISL_SIMD_NEON 1
+#    include <arm_neon.h>
+#endif
+
+// GCC and Clang compile AVX2 kernels only inside functions with the avx2 target, the whole
+// kernel is flattened into such a function, so the baseline code never executes AVX2
+// instructions. MSVC accepts AVX2 intrinsics everywhere.
+#if defined(_MSC_VER) && !defined(__clang__)
+#    define ISL_TARGET_AVX2
+#    define ISL_FLATTEN
+#else
+#    define ISL_TARGET_AVX2 __attribute__((target("avx2")))
+#    define ISL_FLATTEN __attribute__((flatten))
+#endif
+
+// AVX2 vectors are passed only between inlined functions, ABI of other functions is unchanged.
+// Kernels are enclosed in these macros, so the ABI warning stays enabled for other code.
+#if defined(__GNUC__) && !defined(__clang__)
+#    define ISL_SIMD_KERNELS_BEGIN                                                                 \
+        _Pragma("GCC diagnostic push") _Pragma("GCC diagnostic ignored \"-Wpsabi\"")
+#    define ISL_SIMD_KERNELS_END _Pragma("GCC diagnostic pop")
+#else
+#    define ISL_SIMD_KERNELS_BEGIN
+#    define ISL_SIMD_KERNELS_END
+#endif
+
+namespace isl::detail
+{
+#if defined(ISL_SIMD_X86)
+    inline auto hasAvx2() noexcept -> bool
+    {
+#    if defined(__AVX2__)
+        return true;
+#    elif defined(_MSC_VER) && !defined(__clang__)
+        auto info = std::array<int, 4>{};
+
+        __cpuid(info.data(), 0);
+
+        if (info[0] < 7) {
+            return false;
+        }
+
+        __cpuid(info.data(), 1);
+
+        const auto has_os_xsave = (info[2] & (1 << 27)) != 0;
+        const auto has_avx = (info[2] & (1 << 28)) != 0;
+
+        if (!has_os_xsave || !has_avx || (_xgetbv(0) & 6) != 6) {
+            return false;
+        }
+
+        __cpuidex(info.data(), 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#    else
+        return __builtin_cpu_supports("avx2") != 0;
+#    endif
+    }
+#endif
+}// namespace isl::detail
+
+#endif /* ISL_PROJECT_SIMD_DISPATCH_HPP */
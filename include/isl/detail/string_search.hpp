@@ -0,0 +1,139 @@
+#ifndef ISL_PROJECT_STRING_SEARCH_HPP
+#define ISL_PROJECT_STRING_SEARCH_HPP
+
+#include <array>
+#include <isl/detail/defines.hpp>
+#include <isl/detail/kernel_set.hpp>
+#include <isl/detail/types.hpp>
+
+// Vectorized search in byte strings. The kernels are selected at runtime by CPU features:
+// AVX2 or SSE2 on x86, NEON on ARM and a scalar loop elsewhere. Constant evaluation never
+// reaches these functions, callers keep their own constexpr fallback.
+namespace isl::detail::string_search
+{
+    inline constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    // Set of bytes stored as a 256-bit bitmap. Rows of the bitmap are also kept in nibble
+    // tables: byte b is in set if bit (b >> 4) & 7 of row b & 15 is set, rows for bytes below
+    // 128 and above are stored separately. Vector shuffles test 16 or 32 bytes against such
+    // tables at once.
+    class ByteSet
+    {
+    public:
+        // Members are public, so sets are structural types and may be template arguments.
+        std::array<u64, 4> bitmap{};
+        std::array<u8, 16> lowRows{};
+        std::array<u8, 16> highRows{};
+
+        ByteSet() = default;
+
+        template<typename CharT>
+            requires(sizeof(CharT) == 1)
+        constexpr ByteSet(const CharT *chars, const std::size_t count) noexcept
+        {
+            for (std::size_t i = 0; i != count; ++i) {
+                add(static_cast<u8>(chars[i]));
+            }
+        }
+
+        constexpr auto add(const u8 byte) noexcept -> void
+        {
+            bitmap[byte >> 6U] |= u64{1} << (byte & 63U);
+
+            auto &rows = byte < 128 ? lowRows : highRows;
+            rows[byte & 15U] |= static_cast<u8>(1U << ((byte >> 4U) & 7U));
+        }
+
+        constexpr auto remove(const u8 byte) noexcept -> void
+        {
+            bitmap[byte >> 6U] &= ~(u64{1} << (byte & 63U));
+
+            auto &rows = byte < 128 ? lowRows : highRows;
+            rows[byte & 15U] &= static_cast<u8>(~(1U << ((byte >> 4U) & 7U)));
+        }
+
+        ISL_DECL auto contains(const u8 byte) const noexcept -> bool
+        {
+            return ((bitmap[byte >> 6U] >> (byte & 63U)) & 1U) != 0;
+        }
+
+        ISL_DECL auto getLowRows() const noexcept -> const std::array<u8, 16> &
+        {
+            return lowRows;
+        }
+
+        ISL_DECL auto getHighRows() const noexcept -> const std::array<u8, 16> &
+        {
+            return highRows;
+        }
+
+        ISL_DECL auto operator==(const ByteSet &other) const noexcept -> bool = default;
+    };
+
+    // Characters of a range and of strings inside it. Escape character makes the next
+    // character ordinary. All four characters must be different.
+    struct RangeDelimiters
+    {
+        char open;
+        char close;
+        char quote;
+        char escape;
+    };
+
+    // Replaces kernels of all functions below, tests use it to cover every instruction set.
+    // Returns false and keeps the current kernels if the build or the CPU lacks the set. Must not
+    // be called while other threads search.
+    [[nodiscard]] auto selectKernels(KernelSet kernel_set) noexcept -> bool;
+
+    // All functions return index in the given range or npos.
+
+    [[nodiscard]] auto findByte(const char *data, std::size_t size, char chr) noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto findLastByte(const char *data, std::size_t size, char chr) noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto findFirstOf(const char *data, std::size_t size, const ByteSet &set) noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto
+        findFirstNotOf(const char *data, std::size_t size, const ByteSet &set) noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto findLastOf(const char *data, std::size_t size, const ByteSet &set) noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto
+        findLastNotOf(const char *data, std::size_t size, const ByteSet &set) noexcept
+        -> std::size_t;
+
+    [[nodiscard]] auto findSubstring(
+        const char *data, std::size_t size, const char *substring,
+        std::size_t substring_size) noexcept -> std::size_t;
+
+    // Returns index of the first byte that differs in two ranges of the same size.
+    [[nodiscard]] auto findMismatch(const char *lhs, const char *rhs, std::size_t size) noexcept
+        -> std::size_t;
+
+    // Returns mask of the first 64 bytes, bit i is set if byte i equals to chr. Bytes after the
+    // end of the range are never equal.
+    [[nodiscard]] auto equalMask64(const char *data, std::size_t size, char chr) noexcept -> u64;
+
+    // Same as equalMask64, but bit i is set if byte i is in the set.
+    [[nodiscard]] auto setMask64(const char *data, std::size_t size, const ByteSet &set) noexcept
+        -> u64;
+
+    // Returns index of the character where depth of nested ranges returns to zero, the first
+    // character is expected to open a range.
+    [[nodiscard]] auto
+        findRangeEnd(const char *data, std::size_t size, char open, char close) noexcept
+        -> std::size_t;
+
+    // Same as findRangeEnd, but range characters inside strings and escaped characters are
+    // ignored.
+    [[nodiscard]] auto findQuotedRangeEnd(
+        const char *data, std::size_t size, const RangeDelimiters &delimiters) noexcept
+        -> std::size_t;
+}// namespace isl::detail::string_search
+
+#endif /* ISL_PROJECT_STRING_SEARCH_HPP */
@@ -0,0 +1,43 @@
+#ifndef ISL_PROJECT_UNICODE_HPP
+#define ISL_PROJECT_UNICODE_HPP
+
+#include <isl/detail/defines.hpp>
+#include <isl/detail/kernel_set.hpp>
+
+// Vectorized UTF-8 processing, kernels are selected at runtime by CPU features like the ones of
+// string search. Constant evaluation never reaches these functions.
+namespace isl::detail::unicode
+{
+    // Replaces kernels of all functions below like string_search::selectKernels does.
+    [[nodiscard]] auto selectKernels(KernelSet kernel_set) noexcept -> bool;
+
+    // Returns index of the first byte of the first ill-formed sequence or size if the whole
+    // range is valid.
+    [[nodiscard]] auto findFirstInvalidUtf8(const char *data, std::size_t size) noexcept
+        -> std::size_t;
+
+    // Returns number of bytes which are not continuation bytes.
+    [[nodiscard]] auto countUtf8CodePoints(const char *data, std::size_t size) noexcept
+        -> std::size_t;
+
+    // Returns number of UTF-16 code units required for a valid UTF-8 string.
+    [[nodiscard]] auto utf16SizeOfUtf8(const char *data, std::size_t size) noexcept
+        -> std::size_t;
+
+    // Conversions expect valid input and buffer of sufficient size, they return number of
+    // written characters.
+
+    auto decodeUtf8(const char *data, std::size_t size, char16_t *buffer) noexcept
+        -> std::size_t;
+
+    auto decodeUtf8(const char *data, std::size_t size, char32_t *buffer) noexcept
+        -> std::size_t;
+
+    auto encodeUtf8(const char16_t *data, std::size_t size, char *buffer) noexcept
+        -> std::size_t;
+
+    auto encodeUtf8(const char32_t *data, std::size_t size, char *buffer) noexcept
+        -> std::size_t;
+}// namespace isl::detail::unicode
+
+#endif /* ISL_PROJECT_UNICODE_HPP */
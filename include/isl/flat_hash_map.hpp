@@ -0,0 +1,819 @@
+#ifndef ISL_PROJECT_FLAT_HASH_MAP_HPP
+#define ISL_PROJECT_FLAT_HASH_MAP_HPP
+
+#include <ankerl/unordered_dense.h>
+#include <bit>
+#include <isl/flat_map.hpp>
+#include <isl/string_view.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#    include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#    include <arm_neon.h>
+#endif
+
+namespace isl
+{
+    namespace detail
+    {
+        // Control byte of a slot: negative values are special, non-negative values hold the low
+        // 7 bits of the hash of the key stored in the slot.
+        enum struct FlatHashControl : i8
+        {
+            EMPTY = -128,
+            DELETED = -2,
+            SENTINEL = -1,
+        };
+
+        inline constexpr std::size_t FlatHashGroupSize = 16;
+
+        // Set of slot indexes inside a group, each index occupies 1 << Shift bits.
+        template<typename T, unsigned Shift>
+        class FlatHashBitMask
+        {
+        private:
+            T mask;
+
+        public:
+            constexpr explicit FlatHashBitMask(const T bit_mask) noexcept
+              : mask{bit_mask}
+            {}
+
+            [[nodiscard]] constexpr explicit operator bool() const noexcept
+            {
+                return mask != 0;
+            }
+
+            [[nodiscard]] constexpr auto lowest() const noexcept -> std::size_t
+            {
+                return static_cast<std::size_t>(std::countr_zero(mask)) >> Shift;
+            }
+
+            constexpr auto removeLowest() noexcept -> void
+            {
+                mask &= mask - 1;
+            }
+        };
+
+#if defined(__SSE2__) || defined(_M_X64)
+        class FlatHashGroup
+        {
+        private:
+            __m128i control;
+
+        public:
+            explicit FlatHashGroup(const i8 *group_control) noexcept
+              : control{_mm_loadu_si128(reinterpret_cast<const __m128i *>(group_control))}// NOLINT
+            {}
+
+            [[nodiscard]] auto match(const i8 hash) const noexcept -> FlatHashBitMask<u32, 0>
+            {
+                return maskOf(_mm_cmpeq_epi8(_mm_set1_epi8(hash), control));
+            }
+
+            [[nodiscard]] auto matchEmpty() const noexcept -> FlatHashBitMask<u32, 0>
+            {
+                return match(static_cast<i8>(FlatHashControl::EMPTY));
+            }
+
+            // empty and deleted are the only control values with the sign bit set
+            [[nodiscard]] auto matchEmptyOrDeleted() const noexcept -> FlatHashBitMask<u32, 0>
+            {
+                return maskOf(control);
+            }
+
+        private:
+            [[nodiscard]] static auto maskOf(const __m128i bytes) noexcept
+                -> FlatHashBitMask<u32, 0>
+            {
+                return FlatHashBitMask<u32, 0>{static_cast<u32>(_mm_movemask_epi8(bytes))};
+            }
+        };
+#elif defined(__ARM_NEON)
+        class FlatHashGroup
+        {
+        private:
+            int8x16_t control;
+
+        public:
+            explicit FlatHashGroup(const i8 *group_control) noexcept
+              : control{vld1q_s8(group_control)}
+            {}
+
+            [[nodiscard]] auto match(const i8 hash) const noexcept -> FlatHashBitMask<u64, 2>
+            {
+                return maskOf(vceqq_s8(vdupq_n_s8(hash), control));
+            }
+
+            [[nodiscard]] auto matchEmpty() const noexcept -> FlatHashBitMask<u64, 2>
+            {
+                return match(static_cast<i8>(FlatHashControl::EMPTY));
+            }
+
+            [[nodiscard]] auto matchEmptyOrDeleted() const noexcept -> FlatHashBitMask<u64, 2>
+            {
+                return maskOf(vcltzq_s8(control));
+            }
+
+        private:
+            // NEON has no movemask, narrowing shift packs every byte into 4 bits instead
+            [[nodiscard]] static auto maskOf(const uint8x16_t bytes) noexcept
+                -> FlatHashBitMask<u64, 2>
+            {
+                const auto narrowed = vshrn_n_u16(vreinterpretq_u16_u8(bytes), 4);
+                const auto mask = vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+
+                return FlatHashBitMask<u64, 2>{mask & 0x8888'8888'8888'8888ULL};
+            }
+        };
+#else
+        class FlatHashGroup
+        {
+        private:
+            std::array<i8, FlatHashGroupSize> control;
+
+        public:
+            explicit FlatHashGroup(const i8 *group_control) noexcept
+            {
+                std::copy_n(group_control, FlatHashGroupSize, control.begin());
+            }
+
+            [[nodiscard]] auto match(const i8 hash) const noexcept -> FlatHashBitMask<u32, 0>
+            {
+                return maskOf([hash](const i8 value) {
+                    return value == hash;
+                });
+            }
+
+            [[nodiscard]] auto matchEmpty() const noexcept -> FlatHashBitMask<u32, 0>
+            {
+                return match(static_cast<i8>(FlatHashControl::EMPTY));
+            }
+
+            [[nodiscard]] auto matchEmptyOrDeleted() const noexcept -> FlatHashBitMask<u32, 0>
+            {
+                return maskOf([](const i8 value) {
+                    return value < static_cast<i8>(FlatHashControl::SENTINEL);
+                });
+            }
+
+        private:
+            template<typename Predicate>
+            [[nodiscard]] auto maskOf(Predicate predicate) const noexcept
+                -> FlatHashBitMask<u32, 0>
+            {
+                auto mask = u32{};
+
+                for (std::size_t i = 0; i != FlatHashGroupSize; ++i) {
+                    mask |= static_cast<u32>(predicate(control[i])) << i;
+                }
+
+                return FlatHashBitMask<u32, 0>{mask};
+            }
+        };
+#endif
+
+        template<typename Key>
+        struct FlatHashMapHash : ankerl::unordered_dense::hash<Key>
+        {};
+
+        // Strings of every kind hash to the same value, so maps with std::string keys can be
+        // searched with isl::string_view without creating a temporary string.
+        struct FlatHashStringHash
+        {
+            using is_transparent = void;
+            using is_avalanching = void;
+
+            [[nodiscard]] auto operator()(const string_view str) const noexcept -> u64
+            {
+                return ankerl::unordered_dense::hash<string_view>{}(str);
+            }
+
+            [[nodiscard]] auto operator()(const std::string_view str) const noexcept -> u64
+            {
+                return operator()(string_view{str});
+            }
+
+            [[nodiscard]] auto operator()(const std::string &str) const noexcept -> u64
+            {
+                return operator()(string_view{str});
+            }
+
+            [[nodiscard]] auto operator()(const char *str) const noexcept -> u64
+            {
+                return operator()(string_view{str});
+            }
+        };
+
+        template<>
+        struct FlatHashMapHash<std::string> : FlatHashStringHash
+        {};
+
+        template<>
+        struct FlatHashMapHash<std::string_view> : FlatHashStringHash
+        {};
+
+        template<>
+        struct FlatHashMapHash<string_view> : FlatHashStringHash
+        {};
+    }// namespace detail
+
+    // Open addressing hash map in the style of Swiss tables. Every slot has a control byte
+    // holding 7 bits of the key hash, and a group of 16 control bytes is compared against the
+    // searched hash with a single SIMD instruction, so most lookups touch one control group and
+    // one slot. Slots are probed in groups with triangular steps, erased elements become
+    // tombstones only when their group has no empty slots. Iterators and references are
+    // invalidated on rehash.
+    template<
+        typename Key, typename Value, typename Hash = detail::FlatHashMapHash<Key>,
+        typename Equal = std::equal_to<>, typename Allocator = std::allocator<Pair<Key, Value>>>
+    class FlatHashMap
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = Pair<Key, Value>;
+        using hasher = Hash;
+        using key_equal = Equal;
+        using size_type = std::size_t;
+
+    private:
+        using Control = detail::FlatHashControl;
+        using Group = detail::FlatHashGroup;
+        using ValueAllocatorTraits = std::allocator_traits<Allocator>;
+        using ControlAllocator = typename ValueAllocatorTraits::template rebind_alloc<i8>;
+        using ControlAllocatorTraits = std::allocator_traits<ControlAllocator>;
+
+        static constexpr std::size_t GroupSize = detail::FlatHashGroupSize;
+
+        template<bool IsConst>
+        class Iterator
+        {
+        private:
+            friend class FlatHashMap;
+
+            template<bool>
+            friend class Iterator;
+
+            using slot_pointer =
+                std::conditional_t<IsConst, const Pair<Key, Value> *, Pair<Key, Value> *>;
+
+            const i8 *control{};
+            slot_pointer slot{};
+
+        public:
+            using value_type = Pair<Key, Value>;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::conditional_t<IsConst, const value_type &, value_type &>;
+            using pointer = slot_pointer;
+            using iterator_category = std::forward_iterator_tag;
+
+            Iterator() = default;
+
+            template<bool OtherIsConst>
+            requires(IsConst && !OtherIsConst)
+            // NOLINTNEXTLINE
+            Iterator(const Iterator<OtherIsConst> &other) noexcept
+              : control{other.control}
+              , slot{other.slot}
+            {}
+
+            [[nodiscard]] auto operator*() const noexcept -> reference
+            {
+                return *slot;
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> pointer
+            {
+                return slot;
+            }
+
+            auto operator++() noexcept -> Iterator &
+            {
+                ++control;
+                ++slot;
+                skipFreeSlots();
+
+                return *this;
+            }
+
+            auto operator++(int) noexcept -> Iterator
+            {
+                auto old = *this;
+                ++*this;
+                return old;
+            }
+
+            [[nodiscard]] auto operator==(const Iterator &other) const noexcept -> bool
+            {
+                return control == other.control;
+            }
+
+        private:
+            Iterator(const i8 *slot_control, const slot_pointer slot_ptr) noexcept
+              : control{slot_control}
+              , slot{slot_ptr}
+            {}
+
+            // the control array ends with a sentinel, so the loop needs no bounds check
+            auto skipFreeSlots() noexcept -> void
+            {
+                while (*control < static_cast<i8>(Control::SENTINEL)) {
+                    ++control;
+                    ++slot;
+                }
+            }
+        };
+
+    public:
+        using iterator = Iterator<false>;
+        using const_iterator = Iterator<true>;
+
+    private:
+        i8 *controls{};
+        value_type *slots{};
+        std::size_t slotsCount{};
+        std::size_t elementsCount{};
+        std::size_t growthLeft{};
+        ISL_NO_UNIQUE_ADDRESS Hash hashFunction{};
+        ISL_NO_UNIQUE_ADDRESS Equal equalFunction{};
+        ISL_NO_UNIQUE_ADDRESS Allocator allocator{};
+
+    public:
+        FlatHashMap() = default;
+
+        explicit FlatHashMap(const Allocator &value_allocator)
+          : allocator{value_allocator}
+        {}
+
+        explicit FlatHashMap(
+            const Hash &hash, const Equal &equal = Equal{},
+            const Allocator &value_allocator = Allocator{})
+          : hashFunction{hash}
+          , equalFunction{equal}
+          , allocator{value_allocator}
+        {}
+
+        FlatHashMap(const std::initializer_list<value_type> &initial_data)
+        {
+            reserve(initial_data.size());
+
+            for (const auto &value : initial_data) {
+                insert(value);
+            }
+        }
+
+        FlatHashMap(const FlatHashMap &other)
+          : hashFunction{other.hashFunction}
+          , equalFunction{other.equalFunction}
+          , allocator{ValueAllocatorTraits::select_on_container_copy_construction(
+                other.allocator)}
+        {
+            reserve(other.size());
+
+            for (const auto &value : other) {
+                insert(value);
+            }
+        }
+
+        FlatHashMap(FlatHashMap &&other) noexcept
+          : controls{std::exchange(other.controls, nullptr)}
+          , slots{std::exchange(other.slots, nullptr)}
+          , slotsCount{std::exchange(other.slotsCount, 0)}
+          , elementsCount{std::exchange(other.elementsCount, 0)}
+          , growthLeft{std::exchange(other.growthLeft, 0)}
+          , hashFunction{std::move(other.hashFunction)}
+          , equalFunction{std::move(other.equalFunction)}
+          , allocator{std::move(other.allocator)}
+        {}
+
+        ~FlatHashMap()
+        {
+            destroyAndDeallocate();
+        }
+
+        auto operator=(const FlatHashMap &other) -> FlatHashMap &
+        {
+            if (this != &other) {
+                auto copy = other;
+                swap(copy);
+            }
+
+            return *this;
+        }
+
+        auto operator=(FlatHashMap &&other) noexcept -> FlatHashMap &
+        {
+            auto moved = std::move(other);
+            swap(moved);
+            return *this;
+        }
+
+        auto swap(FlatHashMap &other) noexcept -> void
+        {
+            std::swap(controls, other.controls);
+            std::swap(slots, other.slots);
+            std::swap(slotsCount, other.slotsCount);
+            std::swap(elementsCount, other.elementsCount);
+            std::swap(growthLeft, other.growthLeft);
+            std::swap(hashFunction, other.hashFunction);
+            std::swap(equalFunction, other.equalFunction);
+            std::swap(allocator, other.allocator);
+        }
+
+        [[nodiscard]] auto size() const noexcept -> size_type
+        {
+            return elementsCount;
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> bool
+        {
+            return elementsCount == 0;
+        }
+
+        [[nodiscard]] auto capacity() const noexcept -> size_type
+        {
+            return slotsCount;
+        }
+
+        [[nodiscard]] auto begin() noexcept -> iterator
+        {
+            return makeBegin<iterator>(slots);
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator
+        {
+            return makeBegin<const_iterator>(static_cast<const value_type *>(slots));
+        }
+
+        [[nodiscard]] auto end() noexcept -> iterator
+        {
+            return iterator{controls + slotsCount, slots + slotsCount};
+        }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator
+        {
+            return const_iterator{controls + slotsCount, slots + slotsCount};
+        }
+
+        [[nodiscard]] auto cbegin() const noexcept -> const_iterator
+        {
+            return begin();
+        }
+
+        [[nodiscard]] auto cend() const noexcept -> const_iterator
+        {
+            return end();
+        }
+
+        auto clear() noexcept -> void
+        {
+            if (slotsCount == 0) {
+                return;
+            }
+
+            destroyElements();
+            resetControls();
+        }
+
+        auto reserve(const size_type elements) -> void
+        {
+            auto new_slots_count = std::max(slotsCount, GroupSize);
+
+            while (maxElementsFor(new_slots_count) < elements) {
+                new_slots_count *= 2;
+            }
+
+            if (new_slots_count != slotsCount) {
+                rehash(new_slots_count);
+            }
+        }
+
+        template<typename K, typename... Ts>
+        auto tryEmplace(K &&key, Ts &&...args) -> std::pair<iterator, bool>
+            requires std::constructible_from<Key, K &&>
+        {
+            const auto hash = hashOf(key);
+
+            if (const auto index = findIndex(key, hash); index != slotsCount) {
+                return {iteratorAt(index), false};
+            }
+
+            const auto index = prepareInsert(hash);
+            std::construct_at(
+                slots + index, Key(std::forward<K>(key)), Value(std::forward<Ts>(args)...));
+            publishInsert(index, hash);
+
+            return {iteratorAt(index), true};
+        }
+
+        template<typename K, typename V>
+        auto insertOrAssign(K &&key, V &&value) -> std::pair<iterator, bool>
+        {
+            const auto hash = hashOf(key);
+
+            if (const auto index = findIndex(key, hash); index != slotsCount) {
+                slots[index].second = std::forward<V>(value);
+                return {iteratorAt(index), false};
+            }
+
+            const auto index = prepareInsert(hash);
+            std::construct_at(
+                slots + index, Key(std::forward<K>(key)), Value(std::forward<V>(value)));
+            publishInsert(index, hash);
+
+            return {iteratorAt(index), true};
+        }
+
+        auto insert(const value_type &value) -> std::pair<iterator, bool>
+        {
+            return tryEmplace(value.first, value.second);
+        }
+
+        template<typename K = Key>
+        auto erase(const K &key) -> size_type
+        {
+            const auto index = findIndex(key, hashOf(key));
+
+            if (index == slotsCount) {
+                return 0;
+            }
+
+            eraseAt(index);
+            return 1;
+        }
+
+        auto erase(const const_iterator position) -> void
+        {
+            eraseAt(static_cast<std::size_t>(position.control - controls));
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto at(const K &key) ISL_LIFETIMEBOUND -> Value &
+        {
+            return at(*this, key);
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto at(const K &key) const ISL_LIFETIMEBOUND -> const Value &
+        {
+            return at(*this, key);
+        }
+
+        auto operator[](const Key &key) ISL_LIFETIMEBOUND -> Value &
+        {
+            return tryEmplace(key).first->second;
+        }
+
+        auto operator[](Key &&key) ISL_LIFETIMEBOUND -> Value &
+        {
+            return tryEmplace(std::move(key)).first->second;
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto contains(const K &key) const noexcept -> bool
+        {
+            return findIndex(key, hashOf(key)) != slotsCount;
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto find(const K &key) noexcept -> iterator
+        {
+            return iteratorAt(findIndex(key, hashOf(key)));
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto find(const K &key) const noexcept -> const_iterator
+        {
+            const auto index = findIndex(key, hashOf(key));
+            return const_iterator{controls + index, slots + index};
+        }
+
+    private:
+        [[nodiscard]] static constexpr auto maxElementsFor(const std::size_t slots_count) noexcept
+            -> std::size_t
+        {
+            return slots_count - slots_count / 8;
+        }
+
+        [[nodiscard]] static constexpr auto highHash(const u64 hash) noexcept -> std::size_t
+        {
+            return hash >> 7U;
+        }
+
+        [[nodiscard]] static constexpr auto lowHash(const u64 hash) noexcept -> i8
+        {
+            return static_cast<i8>(hash & 0x7FU);
+        }
+
+        template<typename K>
+        [[nodiscard]] auto hashOf(const K &key) const noexcept -> u64
+        {
+            static_assert(
+                std::same_as<K, Key> || (detail::Transparent<Hash> && detail::Transparent<Equal>),
+                "Heterogeneous lookup requires transparent hash and equal");
+
+            const auto hash = static_cast<u64>(hashFunction(key));
+
+            if constexpr (requires { typename Hash::is_avalanching; }) {
+                return hash;
+            } else {
+                return ankerl::unordered_dense::detail::wyhash::hash(hash);
+            }
+        }
+
+        template<typename K>
+        [[nodiscard]] auto findIndex(const K &key, const u64 hash) const noexcept -> std::size_t
+        {
+            if (slotsCount == 0) {
+                return 0;
+            }
+
+            const auto groups_mask = slotsCount / GroupSize - 1;
+            const auto low_hash = lowHash(hash);
+            auto group_index = highHash(hash) & groups_mask;
+
+            for (std::size_t step = 1;; ++step) {
+                const auto *group_control = controls + group_index * GroupSize;
+                const auto group = Group{group_control};
+
+                for (auto matches = group.match(low_hash); matches; matches.removeLowest()) {
+                    const auto index = group_index * GroupSize + matches.lowest();
+
+                    if (equalFunction(slots[index].first, key)) [[likely]] {
+                        return index;
+                    }
+                }
+
+                if (group.matchEmpty()) [[likely]] {
+                    return slotsCount;
+                }
+
+                group_index = (group_index + step) & groups_mask;
+            }
+        }
+
+        [[nodiscard]] auto findFreeSlot(const u64 hash) const noexcept -> std::size_t
+        {
+            const auto groups_mask = slotsCount / GroupSize - 1;
+            auto group_index = highHash(hash) & groups_mask;
+
+            for (std::size_t step = 1;; ++step) {
+                const auto group = Group{controls + group_index * GroupSize};
+
+                if (const auto free = group.matchEmptyOrDeleted(); free) {
+                    return group_index * GroupSize + free.lowest();
+                }
+
+                group_index = (group_index + step) & groups_mask;
+            }
+        }
+
+        // Returns index of a free slot for a new element. The slot stays free until the element
+        // is constructed and published, so a throwing constructor leaves the map unchanged.
+        auto prepareInsert(const u64 hash) -> std::size_t
+        {
+            if (growthLeft == 0) {
+                // tombstones take a large part of the table, rehashing in place frees them
+                if (slotsCount != 0 && elementsCount <= maxElementsFor(slotsCount) / 2) {
+                    rehash(slotsCount);
+                } else {
+                    rehash(std::max(slotsCount * 2, GroupSize));
+                }
+            }
+
+            return findFreeSlot(hash);
+        }
+
+        auto publishInsert(const std::size_t index, const u64 hash) noexcept -> void
+        {
+            if (controls[index] == static_cast<i8>(Control::EMPTY)) {
+                --growthLeft;
+            }
+
+            controls[index] = lowHash(hash);
+            ++elementsCount;
+        }
+
+        auto eraseAt(const std::size_t index) -> void
+        {
+            std::destroy_at(slots + index);
+            --elementsCount;
+
+            // lookups stop at groups with an empty slot, such group may become emptier freely
+            const auto group_begin = index - index % GroupSize;
+
+            if (Group{controls + group_begin}.matchEmpty()) {
+                controls[index] = static_cast<i8>(Control::EMPTY);
+                ++growthLeft;
+            } else {
+                controls[index] = static_cast<i8>(Control::DELETED);
+            }
+        }
+
+        auto rehash(const std::size_t new_slots_count) -> void
+        {
+            // hash and equal may keep a state, such as a seed, so they are copied as well
+            auto new_map = FlatHashMap{hashFunction, equalFunction, allocator};
+            new_map.allocateStorage(new_slots_count);
+
+            for (std::size_t i = 0; i != slotsCount; ++i) {
+                if (controls[i] < 0) {
+                    continue;
+                }
+
+                const auto hash = hashOf(slots[i].first);
+                const auto index = new_map.findFreeSlot(hash);
+
+                new_map.controls[index] = lowHash(hash);
+                std::construct_at(new_map.slots + index, std::move(slots[i]));
+                std::destroy_at(slots + i);
+            }
+
+            new_map.elementsCount = elementsCount;
+            new_map.growthLeft -= elementsCount;
+
+            // elements are already destroyed, only the memory is released
+            elementsCount = 0;
+            swap(new_map);
+        }
+
+        auto allocateStorage(const std::size_t slots_count) -> void
+        {
+            auto control_allocator = ControlAllocator{allocator};
+
+            controls = ControlAllocatorTraits::allocate(control_allocator, slots_count + 1);
+            slots = ValueAllocatorTraits::allocate(allocator, slots_count);
+            slotsCount = slots_count;
+
+            resetControls();
+        }
+
+        auto resetControls() noexcept -> void
+        {
+            std::fill_n(controls, slotsCount, static_cast<i8>(Control::EMPTY));
+            controls[slotsCount] = static_cast<i8>(Control::SENTINEL);
+
+            elementsCount = 0;
+            growthLeft = maxElementsFor(slotsCount);
+        }
+
+        auto destroyElements() noexcept -> void
+        {
+            if constexpr (!std::is_trivially_destructible_v<value_type>) {
+                for (std::size_t i = 0; i != slotsCount; ++i) {
+                    if (controls[i] >= 0) {
+                        std::destroy_at(slots + i);
+                    }
+                }
+            }
+        }
+
+        auto destroyAndDeallocate() noexcept -> void
+        {
+            if (slotsCount == 0) {
+                return;
+            }
+
+            if (elementsCount != 0) {
+                destroyElements();
+            }
+
+            auto control_allocator = ControlAllocator{allocator};
+            ControlAllocatorTraits::deallocate(control_allocator, controls, slotsCount + 1);
+            ValueAllocatorTraits::deallocate(allocator, slots, slotsCount);
+        }
+
+        [[nodiscard]] auto iteratorAt(const std::size_t index) noexcept -> iterator
+        {
+            return iterator{controls + index, slots + index};
+        }
+
+        template<typename It, typename SlotPointer>
+        [[nodiscard]] auto makeBegin(const SlotPointer first_slot) const noexcept -> It
+        {
+            if (slotsCount == 0) {
+                return It{};
+            }
+
+            auto it = It{controls, first_slot};
+            it.skipFreeSlots();
+
+            return it;
+        }
+
+        template<typename Self, typename K>
+        [[nodiscard]] static auto at(Self &self, const K &key) -> auto &
+        {
+            auto elem = self.find(key);
+
+            if (elem == self.end()) {
+                throw std::out_of_range{"Key not found in FlatHashMap at() method."};
+            }
+
+            return elem->second;
+        }
+    };
+}// namespace isl
+
+#endif /* ISL_PROJECT_FLAT_HASH_MAP_HPP */
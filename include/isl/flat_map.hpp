@@ -0,0 +1,297 @@
+#ifndef ISL_PROJECT_FLAT_MAP_HPP
+#define ISL_PROJECT_FLAT_MAP_HPP
+
+#include <isl/isl.hpp>
+#include <isl/iterator.hpp>
+
+namespace isl
+{
+    namespace detail
+    {
+        template<typename T>
+        concept Transparent = requires { typename T::is_transparent; };
+    }// namespace detail
+
+    // Map stored as a vector of pairs sorted by key. Lookups use a branchless binary search, so
+    // there are no mispredicted jumps, and the whole map lives in one allocation. Insertion and
+    // erasure are linear, which is fine for maps that are filled once and then mostly read.
+    template<
+        typename Key, typename Value, typename Compare = std::less<>,
+        typename Allocator = std::allocator<Pair<Key, Value>>>
+    class FlatMap : public AutoImplementedIteratorMethods<FlatMap<Key, Value, Compare, Allocator>>
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = Pair<Key, Value>;
+        using key_compare = Compare;
+        using storage_t = std::vector<value_type, Allocator>;
+        using size_type = std::size_t;
+        using iterator = typename storage_t::iterator;
+        using const_iterator = typename storage_t::const_iterator;
+
+    private:
+        storage_t storage;
+        ISL_NO_UNIQUE_ADDRESS Compare compare{};
+
+    public:
+        FlatMap() = default;
+
+        explicit FlatMap(const Compare &comparator, const Allocator &allocator = Allocator{})
+          : storage{allocator}
+          , compare{comparator}
+        {}
+
+        FlatMap(const std::initializer_list<value_type> &initial_data)
+        {
+            insert(initial_data.begin(), initial_data.end());
+        }
+
+        template<std::input_iterator It, std::sentinel_for<It> S>
+        FlatMap(It first, S last)
+        {
+            insert(first, last);
+        }
+
+        [[nodiscard]] auto size() const noexcept -> size_type
+        {
+            return storage.size();
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> bool
+        {
+            return storage.empty();
+        }
+
+        [[nodiscard]] auto capacity() const noexcept -> size_type
+        {
+            return storage.capacity();
+        }
+
+        [[nodiscard]] auto begin() noexcept -> iterator
+        {
+            return storage.begin();
+        }
+
+        [[nodiscard]] auto end() noexcept -> iterator
+        {
+            return storage.end();
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator
+        {
+            return storage.begin();
+        }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator
+        {
+            return storage.end();
+        }
+
+        auto reserve(const size_type new_capacity) -> void
+        {
+            storage.reserve(new_capacity);
+        }
+
+        auto shrink_to_fit() -> void
+        {
+            storage.shrink_to_fit();
+        }
+
+        auto clear() noexcept -> void
+        {
+            storage.clear();
+        }
+
+        template<typename K, typename... Ts>
+        auto tryEmplace(K &&key, Ts &&...args) -> std::pair<iterator, bool>
+            requires std::constructible_from<Key, K &&>
+        {
+            auto it = lowerBound(key);
+
+            if (it != end() && !compare(key, it->first)) {
+                return {it, false};
+            }
+
+            it = storage.emplace(
+                it, value_type{Key(std::forward<K>(key)), Value(std::forward<Ts>(args)...)});
+
+            return {it, true};
+        }
+
+        template<typename K, typename V>
+        auto insertOrAssign(K &&key, V &&value) -> std::pair<iterator, bool>
+        {
+            auto it = lowerBound(key);
+
+            if (it != end() && !compare(key, it->first)) {
+                it->second = std::forward<V>(value);
+                return {it, false};
+            }
+
+            it = storage.emplace(
+                it, value_type{Key(std::forward<K>(key)), Value(std::forward<V>(value))});
+
+            return {it, true};
+        }
+
+        auto insert(const value_type &value) -> std::pair<iterator, bool>
+        {
+            return tryEmplace(value.first, value.second);
+        }
+
+        // Appends all elements and sorts them once, which is faster than inserting one by one.
+        // For equal keys the first one in the range wins.
+        template<std::input_iterator It, std::sentinel_for<It> S>
+        auto insert(It first, S last) -> void
+        {
+            const auto old_size = static_cast<std::ptrdiff_t>(storage.size());
+
+            if constexpr (std::same_as<It, S>) {
+                storage.insert(storage.end(), first, last);
+            } else {
+                for (; first != last; ++first) {
+                    storage.emplace_back(*first);
+                }
+            }
+
+            const auto by_key = [this](const value_type &lhs, const value_type &rhs) {
+                return compare(lhs.first, rhs.first);
+            };
+
+            const auto new_begin = storage.begin() + old_size;
+            std::stable_sort(new_begin, storage.end(), by_key);
+            std::inplace_merge(storage.begin(), new_begin, storage.end(), by_key);
+
+            const auto duplicates = std::ranges::unique(
+                storage, [this](const value_type &lhs, const value_type &rhs) {
+                    return !compare(lhs.first, rhs.first);
+                });
+
+            storage.erase(duplicates.begin(), duplicates.end());
+        }
+
+        template<typename K = Key>
+        auto erase(const K &key) -> size_type
+        {
+            const auto it = find(key);
+
+            if (it == end()) {
+                return 0;
+            }
+
+            storage.erase(it);
+            return 1;
+        }
+
+        auto erase(const const_iterator position) -> iterator
+        {
+            return storage.erase(position);
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto at(const K &key) ISL_LIFETIMEBOUND -> Value &
+        {
+            return at(*this, key);
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto at(const K &key) const ISL_LIFETIMEBOUND -> const Value &
+        {
+            return at(*this, key);
+        }
+
+        auto operator[](const Key &key) ISL_LIFETIMEBOUND -> Value &
+        {
+            return tryEmplace(key).first->second;
+        }
+
+        auto operator[](Key &&key) ISL_LIFETIMEBOUND -> Value &
+        {
+            return tryEmplace(std::move(key)).first->second;
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto contains(const K &key) const noexcept -> bool
+        {
+            return find(key) != end();
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto find(const K &key) noexcept -> iterator
+        {
+            return find(*this, key);
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto find(const K &key) const noexcept -> const_iterator
+        {
+            return find(*this, key);
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto lowerBound(const K &key) noexcept -> iterator
+        {
+            return begin() + lowerBoundIndex(key);
+        }
+
+        template<typename K = Key>
+        [[nodiscard]] auto lowerBound(const K &key) const noexcept -> const_iterator
+        {
+            return begin() + lowerBoundIndex(key);
+        }
+
+    private:
+        template<typename K>
+        [[nodiscard]] auto lowerBoundIndex(const K &key) const noexcept -> std::ptrdiff_t
+        {
+            static_assert(
+                std::same_as<K, Key> || detail::Transparent<Compare>,
+                "Heterogeneous lookup requires transparent comparator");
+
+            if (storage.empty()) {
+                return 0;
+            }
+
+            const auto *base = storage.data();
+            auto length = storage.size();
+
+            // the range always contains the answer, its size halves on every step and the
+            // pointer update compiles to a conditional move instead of a jump
+            while (length > 1) {
+                const auto half = length / 2;
+                base += compare(base[half].first, key) ? half : 0;
+                length -= half;
+            }
+
+            base += compare(base->first, key) ? 1 : 0;
+            return base - storage.data();
+        }
+
+        template<typename Self, typename K>
+        [[nodiscard]] static auto find(Self &self, const K &key) noexcept -> auto
+        {
+            auto it = self.lowerBound(key);
+
+            if (it != self.end() && !self.compare(key, it->first)) {
+                return it;
+            }
+
+            return self.end();
+        }
+
+        template<typename Self, typename K>
+        [[nodiscard]] static auto at(Self &self, const K &key) -> auto &
+        {
+            auto elem = self.find(key);
+
+            if (elem == self.end()) {
+                throw std::out_of_range{"Key not found in FlatMap at() method."};
+            }
+
+            return elem->second;
+        }
+    };
+}// namespace isl
+
+#endif /* ISL_PROJECT_FLAT_MAP_HPP */
@@ -1,16 +1,32 @@
 #ifndef ISL_PROJECT_MEMORY_HPP
 #define ISL_PROJECT_MEMORY_HPP
 
+#include <isl/allocator_ref.hpp>
 #include <isl/pool_allocator.hpp>
+#include <isl/ref_counter.hpp>
 #include <memory>
+#include <stdexcept>
 
 namespace isl
 {
+    struct AdoptObjectT
+    {
+    };
+
+    // AllocatorPtr is either a pointer to an allocator with static storage duration or
+    // &isl::RuntimeAllocator, in which case the pointer stores an AllocatorRef given to it
+    // at construction time. Allocators which keep objects constructed (object pools) are
+    // neither constructed nor destroyed by the pointer, only taken from and returned to them.
     template <typename T, auto AllocatorPtr>
     requires(AllocatorPtr->template canAllocate<T>())
     class UniquePtr
     {
+    public:
+        using allocator_type = AllocatorRefFor<AllocatorPtr>;
+
+    private:
         T *ptr{nullptr};
+        ISL_NO_UNIQUE_ADDRESS allocator_type allocator{};
 
     public:
         UniquePtr() = default;
@@ -21,23 +37,70 @@ namespace isl
         {}
 
         template <typename... Ts>
-        explicit UniquePtr(Ts &&...args) requires(!std::is_abstract_v<T>)
-          : ptr{static_cast<T *>(AllocatorPtr->allocate())}
-        {
+        explicit UniquePtr(Ts &&...args)
+            requires(
+                !std::is_abstract_v<T> && !IsRuntimeAllocator<AllocatorPtr>
+                && (sizeof...(Ts) == 0 || !allocator_type::keepsObjectsConstructed()))
+          : ptr{static_cast<T *>(allocator.allocate())}
+        {
+            if constexpr (!allocator_type::keepsObjectsConstructed()) {
+                std::construct_at(ptr, std::forward<Ts>(args)...);
+            }
+        }
+
+        template <typename... Ts>
+        explicit UniquePtr(
+            std::allocator_arg_t /* unused */,
+            AllocatorRef runtime_allocator,
+            Ts &&...args)
+            requires(!std::is_abstract_v<T> && IsRuntimeAllocator<AllocatorPtr>)
+          : allocator{runtime_allocator}
+        {
+            if (!allocator.template canAllocate<T>()) {
+                throw std::invalid_argument{"UniquePtr object does not fit the allocator"};
+            }
+
+            // arguments would be dropped silently, the caller would get a reused object
+            if (sizeof...(Ts) != 0 && allocator.keepsObjectsConstructed()) {
+                throw std::invalid_argument{"Pooled objects are already constructed"};
+            }
+
+            ptr = static_cast<T *>(allocator.allocate());
+
+            if (allocator.keepsObjectsConstructed()) {
+                return;
+            }
+
             std::construct_at(ptr, std::forward<Ts>(args)...);
         }
 
+        // Takes ownership of an object obtained from the allocator directly.
+        UniquePtr(AdoptObjectT /* unused */, T *object) noexcept
+            requires(!IsRuntimeAllocator<AllocatorPtr>)
+          : ptr{object}
+        {}
+
+        UniquePtr(AdoptObjectT /* unused */, T *object, AllocatorRef runtime_allocator) noexcept
+            requires(IsRuntimeAllocator<AllocatorPtr>)
+          : ptr{object}
+          , allocator{runtime_allocator}
+        {}
+
         UniquePtr(const UniquePtr &other) = delete;
 
         UniquePtr(UniquePtr &&other) noexcept
-          : ptr{other.release()}
-        {}
+          : allocator{other.getAllocator()}
+        {
+            ptr = other.release();
+        }
 
         template <typename U = T>
         requires(std::convertible_to<U *, T *>) // NOLINTNEXTLINE
         UniquePtr(UniquePtr<U, AllocatorPtr> &&other) noexcept
-          : ptr{other.release()}
-        {}
+          : allocator{other.getAllocator()}
+        {
+            ptr = other.release();
+        }
 
         ~UniquePtr()
         {
@@ -51,6 +114,7 @@ namespace isl
         auto operator=(UniquePtr<U, AllocatorPtr> &&other) noexcept -> UniquePtr &
         {
             destroyStoredObject();
+            allocator = other.getAllocator();
             ptr = other.release();
             return *this;
         }
@@ -58,6 +122,7 @@ namespace isl
         auto operator=(UniquePtr &&other) noexcept -> UniquePtr &
         {
             std::swap(ptr, other.ptr);
+            std::swap(allocator, other.allocator);
             return *this;
         }
 
@@ -66,10 +131,16 @@ namespace isl
             return ptr == nullptr;
         }
 
-        [[nodiscard]] auto operator==(const UniquePtr &other) const noexcept -> bool = default;
+        [[nodiscard]] auto operator==(const UniquePtr &other) const noexcept -> bool
+        {
+            return ptr == other.ptr;
+        }
 
-        [[nodiscard]] auto
-            operator<=>(const UniquePtr &other) const noexcept -> std::weak_ordering = default;
+        [[nodiscard]] auto operator<=>(const UniquePtr &other) const noexcept
+            -> std::weak_ordering
+        {
+            return std::compare_three_way{}(ptr, other.ptr);
+        }
 
         [[nodiscard]] auto operator*() -> T &
         {
@@ -101,39 +172,75 @@ namespace isl
             return ptr;
         }
 
+        [[nodiscard]] auto getAllocator() const noexcept -> allocator_type
+        {
+            return allocator;
+        }
+
         auto release() -> T *
         {
             return std::exchange(ptr, nullptr);
         }
 
         static auto createDefault() -> UniquePtr
+            requires(!IsRuntimeAllocator<AllocatorPtr>)
         {
             auto un_ptr = UniquePtr{};
 
-            un_ptr.ptr = static_cast<T *>(AllocatorPtr->allocate());
-            std::construct_at(un_ptr.ptr);
+            un_ptr.ptr = static_cast<T *>(un_ptr.allocator.allocate());
+
+            if constexpr (!allocator_type::keepsObjectsConstructed()) {
+                std::construct_at(un_ptr.ptr);
+            }
 
             return un_ptr;
         }
 
+        static auto createDefault(AllocatorRef runtime_allocator) -> UniquePtr
+            requires(IsRuntimeAllocator<AllocatorPtr>)
+        {
+            return UniquePtr{std::allocator_arg, runtime_allocator};
+        }
+
     private:
         auto destroyStoredObject() -> void
         {
             if (ptr != nullptr) {
-                std::destroy_at(ptr);
-                AllocatorPtr->deallocate(static_cast<void *>(ptr));
+                if (!allocator.keepsObjectsConstructed()) {
+                    std::destroy_at(ptr);
+                }
+
+                allocator.deallocate(static_cast<void *>(ptr));
             }
 
             ptr = nullptr;
         }
     };
 
-    template <std::size_t Capacity, std::size_t Alignment>
+    namespace detail
+    {
+        struct NoFrameAllocator
+        {
+        };
+    } // namespace detail
+
+    // Frames which store their allocator are required by SharedPtr<T, Frame, &RuntimeAllocator>.
+    template <
+        std::size_t Capacity,
+        std::size_t Alignment,
+        RefCountPolicy Policy = RefCountPolicy::ATOMIC,
+        bool StoresAllocator = false>
     struct SharedPtrFrame
     {
-        mutable std::atomic<std::size_t> refCount{1};
+        static constexpr auto refCountPolicy = Policy;
+        static constexpr auto storesAllocator = StoresAllocator;
+
+        // must stay the first member, biased counter passes its address to the releaser
+        RefCounter<Policy> refCount;
         alignas(Alignment) std::byte objectBuffer[Capacity];
         void (*deleter)(void *) = nullptr;
+        ISL_NO_UNIQUE_ADDRESS
+        std::conditional_t<StoresAllocator, AllocatorRef, detail::NoFrameAllocator> allocator;
 
         template <typename T>
         ISL_DECL static auto canStore() noexcept -> bool
@@ -171,32 +278,100 @@ namespace isl
             return Alignment;
         }
 
-        auto increaseRefCount() const -> std::size_t
+        auto increaseRefCount() const -> void
+        {
+            refCount.increase();
+        }
+
+        // Returns true when the caller has released the last reference.
+        [[nodiscard]] auto decreaseRefCount() const -> bool
+        {
+            return refCount.decrease();
+        }
+
+        // Strong references share one weak reference that is released after the object
+        // has been destroyed. Biased frames have no weak references at all.
+        [[nodiscard]] auto decreaseWeakRefCount() const -> bool
+        {
+            if constexpr (Policy == RefCountPolicy::BIASED) {
+                return true;
+            } else {
+                return refCount.decreaseWeak();
+            }
+        }
+
+        auto increaseWeakRefCount() const -> void
+            requires(Policy != RefCountPolicy::BIASED)
+        {
+            refCount.increaseWeak();
+        }
+
+        [[nodiscard]] auto tryIncreaseRefCount() const -> bool
+            requires(Policy != RefCountPolicy::BIASED)
         {
-            return refCount.fetch_add(1, std::memory_order_acq_rel);
+            return refCount.tryIncrease();
         }
 
-        [[nodiscard]] auto decreaseRefCount() const -> std::size_t
+        [[nodiscard]] auto getUseCount() const -> std::size_t
+            requires(Policy != RefCountPolicy::BIASED)
         {
-            return refCount.fetch_sub(1, std::memory_order_acq_rel);
+            return refCount.useCount();
+        }
+
+        // Frames released by a thread other than the one that dropped the last reference
+        // (biased counting only) are freed through this function.
+        auto setReleaser(void (*releaser)(void *)) noexcept -> void
+        {
+            if constexpr (Policy == RefCountPolicy::BIASED) {
+                refCount.setReleaser(releaser);
+            }
+        }
+
+        auto destroyObject() -> void
+        {
+            deleter(static_cast<void *>(std::addressof(objectBuffer[0])));
         }
 
         template <typename T, typename... Ts>
         requires(canStore<T>())
         static auto initialize(SharedPtrFrame *frame, Ts &&...args) -> void
         {
-            std::construct_at(std::addressof(frame->refCount), 1U);
+            std::construct_at(std::addressof(frame->refCount));
             std::construct_at(frame->asPtr<T>(), std::forward<Ts>(args)...);
 
             frame->deleter = [](void *ptr) { std::destroy_at(static_cast<T *>(ptr)); };
         }
     };
 
+    template <RefCountPolicy Policy, typename... Ts>
+    using SharedPtrFrameWithPolicyFor =
+        SharedPtrFrame<ObjectsMaxSize<Ts...>, ObjectsMaxAlignment<Ts...>, Policy>;
+
     template <typename... Ts>
-    using SharedPtrFrameFor = SharedPtrFrame<ObjectsMaxSize<Ts...>, ObjectsMaxAlignment<Ts...>>;
+    using SharedPtrFrameFor = SharedPtrFrameWithPolicyFor<RefCountPolicy::ATOMIC, Ts...>;
+
+    template <RefCountPolicy Policy, typename... Ts>
+    using RuntimeAllocatedSharedPtrFrameFor =
+        SharedPtrFrame<ObjectsMaxSize<Ts...>, ObjectsMaxAlignment<Ts...>, Policy, true>;
+
+    namespace detail
+    {
+        template <auto AllocatorPtr, typename Frame>
+        auto deallocateFrame(Frame *frame) -> void
+        {
+            if constexpr (IsRuntimeAllocator<AllocatorPtr>) {
+                const auto allocator = frame->allocator;
+                allocator.deallocate(static_cast<void *>(frame));
+            } else {
+                AllocatorPtr->deallocate(static_cast<void *>(frame));
+            }
+        }
+    } // namespace detail
 
     template <typename T, typename Frame, auto AllocatorPtr>
-    requires(AllocatorPtr->template canAllocate<Frame>())
+    requires(
+        AllocatorPtr->template canAllocate<Frame>()
+        && (!IsRuntimeAllocator<AllocatorPtr> || Frame::storesAllocator))
     class SharedPtr;
 
     struct FrameMovedT
@@ -208,7 +383,9 @@ namespace isl
     };
 
     template <typename T, typename Frame, auto AllocatorPtr>
-    requires(AllocatorPtr->template canAllocate<Frame>())
+    requires(
+        AllocatorPtr->template canAllocate<Frame>()
+        && (!IsRuntimeAllocator<AllocatorPtr> || Frame::storesAllocator))
     class SharedPtr
     {
     private:
@@ -232,11 +409,33 @@ namespace isl
         }
 
         template <typename... Ts>
-        requires(!std::is_abstract_v<T>)
+        requires(
+            !std::is_abstract_v<T> && std::constructible_from<T, Ts...>
+            && !IsRuntimeAllocator<AllocatorPtr>)
         explicit SharedPtr(Ts &&...args)
           : frame{static_cast<Frame *>(AllocatorPtr->allocate())}
         {
             Frame::template initialize<T>(frame, std::forward<Ts>(args)...);
+            frame->setReleaser(&freeFrame);
+        }
+
+        template <typename... Ts>
+        requires(
+            !std::is_abstract_v<T> && std::constructible_from<T, Ts...>
+            && IsRuntimeAllocator<AllocatorPtr>)
+        explicit SharedPtr(
+            std::allocator_arg_t /* unused */,
+            AllocatorRef runtime_allocator,
+            Ts &&...args)
+        {
+            if (!runtime_allocator.template canAllocate<Frame>()) {
+                throw std::invalid_argument{"SharedPtr frame does not fit the allocator"};
+            }
+
+            frame = static_cast<Frame *>(runtime_allocator.allocate());
+            Frame::template initialize<T>(frame, std::forward<Ts>(args)...);
+            std::construct_at(std::addressof(frame->allocator), runtime_allocator);
+            frame->setReleaser(&freeFrame);
         }
 
         template <typename U = T>
@@ -390,9 +589,119 @@ namespace isl
 
         auto decreaseRefCount() -> void
         {
-            if (frame != nullptr && frame->decreaseRefCount() == 1) {
-                frame->deleter(frame->template asPtr<T>());
-                AllocatorPtr->deallocate(static_cast<void *>(frame));
+            if (frame != nullptr && frame->decreaseRefCount()) {
+                freeFrame(static_cast<void *>(frame));
+            }
+        }
+
+        static auto freeFrame(void *frame_ptr) -> void
+        {
+            static_assert(std::is_standard_layout_v<Frame>);
+
+            auto *shared_frame = static_cast<Frame *>(frame_ptr);
+            shared_frame->destroyObject();
+
+            if (shared_frame->decreaseWeakRefCount()) {
+                detail::deallocateFrame<AllocatorPtr>(shared_frame);
+            }
+        }
+    };
+
+    // Does not keep the object alive, only its frame. Biased frames are not supported:
+    // non-owner threads cannot tell whether such an object is still alive.
+    template <typename T, typename Frame, auto AllocatorPtr>
+    requires(Frame::refCountPolicy != RefCountPolicy::BIASED)
+    class WeakPtr
+    {
+    private:
+        Frame *frame{};
+
+    public:
+        WeakPtr() = default;
+
+        WeakPtr(std::nullptr_t) noexcept
+          : WeakPtr{}
+        {}
+
+        template <typename U = T>
+        requires(std::convertible_to<U *, T *>) // NOLINTNEXTLINE
+        WeakPtr(const SharedPtr<U, Frame, AllocatorPtr> &shared)
+          : frame{shared.getFrame()}
+        {
+            increaseWeakRefCount();
+        }
+
+        WeakPtr(const WeakPtr &other)
+          : frame{other.frame}
+        {
+            increaseWeakRefCount();
+        }
+
+        WeakPtr(WeakPtr &&other) noexcept
+          : frame{std::exchange(other.frame, nullptr)}
+        {}
+
+        ~WeakPtr()
+        {
+            decreaseWeakRefCount();
+        }
+
+        auto operator=(const WeakPtr &other) -> WeakPtr &
+        {
+            if (this != std::addressof(other)) {
+                decreaseWeakRefCount();
+                frame = other.frame;
+                increaseWeakRefCount();
+            }
+
+            return *this;
+        }
+
+        auto operator=(WeakPtr &&other) noexcept -> WeakPtr &
+        {
+            std::swap(frame, other.frame);
+            return *this;
+        }
+
+        [[nodiscard]] auto operator==(const WeakPtr &other) const noexcept -> bool = default;
+
+        [[nodiscard]] auto expired() const noexcept -> bool
+        {
+            return frame == nullptr || frame->getUseCount() == 0;
+        }
+
+        [[nodiscard]] auto lock() const noexcept -> SharedPtr<T, Frame, AllocatorPtr>
+        {
+            if (frame != nullptr && frame->tryIncreaseRefCount()) {
+                return SharedPtr<T, Frame, AllocatorPtr>{FrameMovedT{}, frame};
+            }
+
+            return nullptr;
+        }
+
+        [[nodiscard]] auto getFrame() const noexcept -> Frame *
+        {
+            return frame;
+        }
+
+        auto reset() -> void
+        {
+            decreaseWeakRefCount();
+            frame = nullptr;
+        }
+
+    private:
+        auto increaseWeakRefCount() const noexcept -> void
+        {
+            if (frame != nullptr) {
+                frame->increaseWeakRefCount();
+            }
+        }
+
+        auto decreaseWeakRefCount() -> void
+        {
+            if (frame != nullptr && frame->decreaseWeakRefCount()) {
+                detail::deallocateFrame<AllocatorPtr>(frame);
             }
         }
     };
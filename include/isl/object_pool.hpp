@@ -0,0 +1,238 @@
+#ifndef ISL_PROJECT_OBJECT_POOL_HPP
+#define ISL_PROJECT_OBJECT_POOL_HPP
+
+#include <isl/id_generator.hpp>
+#include <isl/memory.hpp>
+#include <isl/thread/spin_lock.hpp>
+#include <mutex>
+#include <thread>
+
+namespace isl
+{
+    struct NoObjectReset
+    {
+        template <typename T>
+        constexpr auto operator()(T & /* unused */) const noexcept -> void
+        {}
+    };
+
+    namespace detail
+    {
+        [[nodiscard]] inline auto objectPoolThreadIndex() -> std::size_t
+        {
+            static constinit auto generator = IdGenerator<std::size_t>{0};
+            thread_local const auto index = generator.next();
+
+            return index;
+        }
+    } // namespace detail
+
+    // Keeps objects constructed between uses, so expensive to construct objects (buffers,
+    // parsers, connections) are created once and reused. Returned objects are passed to
+    // ResetHook and put into the cache of the returning thread. Every thread is mapped to its
+    // own cache, other caches are only visited when the own cache is empty. Leases and
+    // UniquePtr's obtained from the pool must not outlive it.
+    template <std::default_initializable T, typename ResetHook = NoObjectReset>
+    requires std::invocable<ResetHook &, T &>
+    class ObjectPool
+    {
+    private:
+        struct ISL_HARDWARE_CACHE_LINE_ALIGN LocalCache
+        {
+            thread::SpinLock lock;
+            std::vector<T *> objects;
+        };
+
+        std::vector<LocalCache> caches;
+        std::atomic<std::size_t> createdObjects{};
+        ISL_NO_UNIQUE_ADDRESS ResetHook resetHook;
+
+    public:
+        static constexpr bool keepsObjectsConstructed = true;
+
+        class Lease
+        {
+        private:
+            ObjectPool *pool{};
+            T *object{};
+
+        public:
+            Lease() = default;
+
+            Lease(ObjectPool &object_pool ISL_LIFETIMEBOUND, T *pooled_object) noexcept
+              : pool{std::addressof(object_pool)}
+              , object{pooled_object}
+            {}
+
+            Lease(const Lease &) = delete;
+
+            Lease(Lease &&other) noexcept
+              : pool{other.pool}
+              , object{std::exchange(other.object, nullptr)}
+            {}
+
+            ~Lease()
+            {
+                reset();
+            }
+
+            auto operator=(const Lease &) -> Lease & = delete;
+
+            auto operator=(Lease &&other) noexcept -> Lease &
+            {
+                std::swap(pool, other.pool);
+                std::swap(object, other.object);
+
+                return *this;
+            }
+
+            [[nodiscard]] explicit operator bool() const noexcept
+            {
+                return object != nullptr;
+            }
+
+            [[nodiscard]] auto get() const noexcept -> T *
+            {
+                return object;
+            }
+
+            [[nodiscard]] auto operator*() const noexcept -> T &
+            {
+                return *object;
+            }
+
+            [[nodiscard]] auto operator->() const noexcept -> T *
+            {
+                return object;
+            }
+
+            auto reset() -> void
+            {
+                if (object != nullptr) {
+                    pool->deallocate(std::exchange(object, nullptr));
+                }
+            }
+        };
+
+        using UniquePtrType = UniquePtr<T, &RuntimeAllocator>;
+
+        explicit ObjectPool(ResetHook reset_hook = {}, std::size_t caches_count = 0)
+          : caches(
+                caches_count != 0 ? caches_count
+                                  : std::max<std::size_t>(std::thread::hardware_concurrency(), 1))
+          , resetHook{std::move(reset_hook)}
+        {}
+
+        ObjectPool(const ObjectPool &) = delete;
+        ObjectPool(ObjectPool &&) = delete;
+
+        ~ObjectPool()
+        {
+            auto destroyed_objects = std::size_t{};
+
+            for (auto &cache : caches) {
+                destroyed_objects += cache.objects.size();
+
+                for (auto *object : cache.objects) {
+                    ::delete object;
+                }
+            }
+
+            ISL_ASSERT_MSG(
+                destroyed_objects == createdObjects.load(std::memory_order_relaxed),
+                "Objects from ObjectPool must be returned before its destruction");
+        }
+
+        auto operator=(const ObjectPool &) -> ObjectPool & = delete;
+        auto operator=(ObjectPool &&) -> ObjectPool & = delete;
+
+        template <typename U>
+        ISL_DECL static auto canAllocate() noexcept -> bool
+        {
+            return std::same_as<U, T>;
+        }
+
+        ISL_DECL static auto getMaxObjectSize() noexcept -> std::size_t
+        {
+            return sizeof(T);
+        }
+
+        ISL_DECL static auto getAllocationAlignment() noexcept -> std::size_t
+        {
+            return alignof(T);
+        }
+
+        [[nodiscard]] auto getCreatedObjectsCount() const noexcept -> std::size_t
+        {
+            return createdObjects.load(std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto acquire() -> Lease
+        {
+            return Lease{*this, static_cast<T *>(allocate())};
+        }
+
+        [[nodiscard]] auto acquireUnique() -> UniquePtrType
+        {
+            return UniquePtrType{AdoptObjectT{}, static_cast<T *>(allocate()), AllocatorRef{*this}};
+        }
+
+        // Returns a constructed object, never raw memory.
+        [[nodiscard]] auto allocate() -> void *
+        {
+            const auto local_index = detail::objectPoolThreadIndex() % caches.size();
+
+            if (auto *object = takeFrom(caches[local_index], false); object != nullptr) {
+                return object;
+            }
+
+            for (std::size_t i = 1; i != caches.size(); ++i) {
+                auto &cache = caches[(local_index + i) % caches.size()];
+
+                if (auto *object = takeFrom(cache, true); object != nullptr) {
+                    return object;
+                }
+            }
+
+            auto *object = ::new T{};
+            createdObjects.fetch_add(1, std::memory_order_relaxed);
+
+            return object;
+        }
+
+        auto deallocate(void *ptr) -> void
+        {
+            auto *object = static_cast<T *>(ptr);
+            std::invoke(resetHook, *object);
+
+            auto &cache = caches[detail::objectPoolThreadIndex() % caches.size()];
+            const auto lock = std::scoped_lock{cache.lock};
+
+            cache.objects.emplace_back(object);
+        }
+
+    private:
+        static auto takeFrom(LocalCache &cache, bool skip_busy) -> T *
+        {
+            if (skip_busy) {
+                if (!cache.lock.tryLock()) {
+                    return nullptr;
+                }
+            } else {
+                cache.lock.lock();
+            }
+
+            auto *object = static_cast<T *>(nullptr);
+
+            if (!cache.objects.empty()) {
+                object = cache.objects.back();
+                cache.objects.pop_back();
+            }
+
+            cache.lock.unlock();
+            return object;
+        }
+    };
+} // namespace isl
+
+#endif /* ISL_PROJECT_OBJECT_POOL_HPP */
@@ -0,0 +1,308 @@
+#ifndef ISL_PROJECT_PERFECT_HASH_MAP_HPP
+#define ISL_PROJECT_PERFECT_HASH_MAP_HPP
+
+#include <bit>
+#include <isl/string_view.hpp>
+#include <vector>
+
+namespace isl
+{
+    // Hash usable during constant evaluation. Strings of any kind with the same characters
+    // have the same hash.
+    struct PerfectHash
+    {
+        ISL_DECL static auto mix(u64 value) noexcept -> u64
+        {
+            // NOLINTBEGIN
+            value ^= value >> 33U;
+            value *= 0xFF51'AFD7'ED55'8CCDULL;
+            value ^= value >> 33U;
+            value *= 0xC4CE'B9FE'1A85'EC53ULL;
+            value ^= value >> 33U;
+            // NOLINTEND
+
+            return value;
+        }
+
+        template<typename T>
+            requires(std::integral<T> || std::is_enum_v<T>)
+        ISL_DECL auto operator()(const T value) const noexcept -> u64
+        {
+            if constexpr (std::is_enum_v<T>) {
+                return mix(static_cast<u64>(static_cast<std::underlying_type_t<T>>(value)));
+            } else {
+                return mix(static_cast<u64>(value));
+            }
+        }
+
+        template<CharacterLiteral CharT>
+        ISL_DECL auto operator()(const BasicStringView<CharT> str) const noexcept -> u64
+        {
+            // FNV-1a
+            auto hash = u64{0xCBF2'9CE4'8422'2325ULL};
+
+            for (const CharT chr : str) {
+                hash ^= static_cast<u64>(chr);
+                hash *= u64{0x100'0000'01B3ULL};
+            }
+
+            return mix(hash);
+        }
+
+        template<CharacterLiteral CharT>
+        ISL_DECL auto operator()(const std::basic_string_view<CharT> str) const noexcept -> u64
+        {
+            return operator()(BasicStringView<CharT>{str.data(), str.size()});
+        }
+    };
+
+    // Immutable map built during compilation with the hash and displace algorithm. Keys are
+    // split into buckets by their hash, every bucket gets a displacement that moves all of its
+    // keys into free slots. A lookup hashes the key once, reads the displacement of its bucket
+    // and compares the key with the only entry it may be, so there are no probes and no
+    // collisions at runtime.
+    template<typename Key, typename Value, std::size_t Size, typename Hash = PerfectHash>
+        requires(Size != 0)
+    class PerfectHashMap
+      : public AutoImplementedIteratorMethods<PerfectHashMap<Key, Value, Size, Hash>>
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = Value;
+        using value_type = Pair<Key, Value>;
+        using storage_t = std::array<value_type, Size>;
+        using const_iterator = typename storage_t::const_iterator;
+        using iterator = const_iterator;
+
+    private:
+        using Index = std::conditional_t<
+            (Size <= std::numeric_limits<u8>::max()), u8,
+            std::conditional_t<(Size <= std::numeric_limits<u16>::max()), u16, u32>>;
+
+        // slots always outnumber keys, buckets placed last would need too many attempts in a full
+        // table
+        static constexpr std::size_t slotsCount = std::bit_ceil(Size + Size / 4 + 1);
+        static constexpr std::size_t bucketsCount = std::max<std::size_t>(slotsCount / 2, 1);
+        static constexpr u32 maxDisplacement = 1U << 17U;
+
+        storage_t entries{};
+        std::array<u32, bucketsCount> displacements{};
+        // empty slots point to the first entry, its key differs from every missing key
+        std::array<Index, slotsCount> slots{};
+
+    public:
+        consteval PerfectHashMap(const std::initializer_list<value_type> &initial_data)
+        {
+            if (initial_data.size() != Size) {
+                throw std::invalid_argument{"PerfectHashMap size does not match initial data"};
+            }
+
+            std::ranges::copy(initial_data, entries.begin());
+            build();
+        }
+
+        consteval explicit PerfectHashMap(const std::array<value_type, Size> &initial_data)
+          : entries{initial_data}
+        {
+            build();
+        }
+
+        ISL_DECL static auto size() noexcept -> std::size_t
+        {
+            return Size;
+        }
+
+        ISL_DECL auto begin() const noexcept -> const_iterator
+        {
+            return entries.begin();
+        }
+
+        ISL_DECL auto end() const noexcept -> const_iterator
+        {
+            return entries.end();
+        }
+
+        ISL_DECL auto find(const Key &key) const noexcept -> const_iterator
+        {
+            const auto hash = static_cast<u64>(Hash{}(key));
+            const auto displacement = displacements[bucketOf(hash)];
+            const auto index = slots[slotOf(hash, displacement)];
+
+            if (entries[index].first == key) {
+                return entries.begin() + index;
+            }
+
+            return entries.end();
+        }
+
+        ISL_DECL auto contains(const Key &key) const noexcept -> bool
+        {
+            return find(key) != end();
+        }
+
+        ISL_DECL auto at(const Key &key) const ISL_LIFETIMEBOUND -> const Value &
+        {
+            const auto it = find(key);
+
+            if (it == end()) {
+                throw std::out_of_range{"Key not found in PerfectHashMap at() method."};
+            }
+
+            return it->second;
+        }
+
+        ISL_DECL auto operator[](const Key &key) const ISL_LIFETIMEBOUND->const Value &
+        {
+            return at(key);
+        }
+
+    private:
+        ISL_DECL static auto bucketOf(const u64 hash) noexcept -> std::size_t
+        {
+            return (hash >> 32U) & (bucketsCount - 1);
+        }
+
+        ISL_DECL static auto slotOf(const u64 hash, const u32 displacement) noexcept
+            -> std::size_t
+        {
+            constexpr auto golden_ratio = u64{0x9E37'79B9'7F4A'7C15ULL};
+
+            return PerfectHash::mix(hash ^ (displacement * golden_ratio)) & (slotsCount - 1);
+        }
+
+        consteval auto build() -> void
+        {
+            auto hashes = std::array<u64, Size>{};
+
+            for (std::size_t i = 0; i != Size; ++i) {
+                hashes[i] = static_cast<u64>(Hash{}(entries[i].first));
+            }
+
+            // counting sort of keys by bucket
+            auto bucket_begin = std::array<std::size_t, bucketsCount + 1>{};
+            auto keys_by_bucket = std::array<std::size_t, Size>{};
+
+            for (const auto hash : hashes) {
+                ++bucket_begin[bucketOf(hash) + 1];
+            }
+
+            for (std::size_t i = 0; i != bucketsCount; ++i) {
+                bucket_begin[i + 1] += bucket_begin[i];
+            }
+
+            auto bucket_fill = bucket_begin;
+
+            for (std::size_t i = 0; i != Size; ++i) {
+                keys_by_bucket[bucket_fill[bucketOf(hashes[i])]++] = i;
+            }
+
+            checkHashesAreUnique(hashes, bucket_begin, keys_by_bucket);
+
+            auto largest_bucket = std::size_t{};
+
+            for (std::size_t i = 0; i != bucketsCount; ++i) {
+                largest_bucket = std::max(largest_bucket, bucket_begin[i + 1] - bucket_begin[i]);
+            }
+
+            // large buckets are the hardest to place, so they go first while the table is empty.
+            // Buckets hold few keys, a pass for every size is cheaper than a sort during constant
+            // evaluation.
+            auto buckets_order = std::array<std::size_t, bucketsCount>{};
+            auto ordered_count = std::size_t{};
+
+            for (auto bucket_size = largest_bucket; bucket_size != 0; --bucket_size) {
+                for (std::size_t i = 0; i != bucketsCount; ++i) {
+                    if (bucket_begin[i + 1] - bucket_begin[i] == bucket_size) {
+                        buckets_order[ordered_count++] = i;
+                    }
+                }
+            }
+
+            auto taken = std::array<bool, slotsCount>{};
+            auto new_slots = std::vector<std::size_t>(largest_bucket);
+
+            for (const auto bucket : std::span{buckets_order.data(), ordered_count}) {
+                const auto first = bucket_begin[bucket];
+                const auto last = bucket_begin[bucket + 1];
+
+                displacements[bucket] = findDisplacement(
+                    taken, hashes, std::span{keys_by_bucket.begin() + first, last - first},
+                    new_slots);
+
+                for (std::size_t i = first; i != last; ++i) {
+                    const auto key_index = keys_by_bucket[i];
+                    const auto slot = slotOf(hashes[key_index], displacements[bucket]);
+
+                    taken[slot] = true;
+                    slots[slot] = static_cast<Index>(key_index);
+                }
+            }
+        }
+
+        // Keys are already sorted by bucket, so equal hashes are searched only inside buckets.
+        consteval auto checkHashesAreUnique(
+            const std::array<u64, Size> &hashes,
+            const std::array<std::size_t, bucketsCount + 1> &bucket_begin,
+            const std::array<std::size_t, Size> &keys_by_bucket) const -> void
+        {
+            for (std::size_t bucket = 0; bucket != bucketsCount; ++bucket) {
+                for (auto i = bucket_begin[bucket]; i != bucket_begin[bucket + 1]; ++i) {
+                    for (auto j = bucket_begin[bucket]; j != i; ++j) {
+                        const auto lhs = keys_by_bucket[i];
+                        const auto rhs = keys_by_bucket[j];
+
+                        if (hashes[lhs] != hashes[rhs]) {
+                            continue;
+                        }
+
+                        if (entries[lhs].first == entries[rhs].first) {
+                            throw std::invalid_argument{"PerfectHashMap keys must be unique"};
+                        }
+
+                        throw std::invalid_argument{"PerfectHashMap keys have equal hashes"};
+                    }
+                }
+            }
+        }
+
+        // New slots is a scratch buffer not smaller than the bucket, it is reused by all
+        // attempts.
+        static consteval auto findDisplacement(
+            const std::array<bool, slotsCount> &taken, const std::array<u64, Size> &hashes,
+            const std::span<const std::size_t> bucket_keys, std::vector<std::size_t> &new_slots)
+            -> u32
+        {
+            for (u32 displacement = 0; displacement != maxDisplacement; ++displacement) {
+                auto placed = std::size_t{};
+
+                for (const auto key_index : bucket_keys) {
+                    const auto slot = slotOf(hashes[key_index], displacement);
+                    const auto placed_slots = std::span{new_slots.data(), placed};
+                    const auto is_placed =
+                        std::ranges::find(placed_slots, slot) != placed_slots.end();
+
+                    if (taken[slot] || is_placed) {
+                        break;
+                    }
+
+                    new_slots[placed++] = slot;
+                }
+
+                if (placed == bucket_keys.size()) {
+                    return displacement;
+                }
+            }
+
+            throw std::invalid_argument{"Failed to build PerfectHashMap"};
+        }
+    };
+
+    template<typename Key, typename Value, std::size_t Size, typename Hash = PerfectHash>
+    consteval auto makePerfectHashMap(const Pair<Key, Value> (&initial_data)[Size])// NOLINT
+        -> PerfectHashMap<Key, Value, Size, Hash>
+    {
+        return PerfectHashMap<Key, Value, Size, Hash>{std::to_array(initial_data)};
+    }
+}// namespace isl
+
+#endif /* ISL_PROJECT_PERFECT_HASH_MAP_HPP */
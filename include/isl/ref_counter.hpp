@@ -0,0 +1,261 @@
+#ifndef ISL_PROJECT_REF_COUNTER_HPP
+#define ISL_PROJECT_REF_COUNTER_HPP
+
+#include <atomic>
+#include <isl/isl.hpp>
+
+namespace isl
+{
+    enum class RefCountPolicy : u8
+    {
+        SINGLE_THREADED,
+        ATOMIC,
+        BIASED,
+    };
+
+    template <RefCountPolicy Policy>
+    class RefCounter;
+
+    // Weak count is the number of weak references plus one for all strong references
+    // together, so the memory is released when both groups are gone.
+    template <>
+    class RefCounter<RefCountPolicy::SINGLE_THREADED>
+    {
+    private:
+        mutable std::size_t refCount{1};
+        mutable std::size_t weakCount{1};
+
+    public:
+        RefCounter() = default;
+
+        auto increase() const noexcept -> void
+        {
+            ++refCount;
+        }
+
+        // Returns true when the last reference has been released.
+        [[nodiscard]] auto decrease() const noexcept -> bool
+        {
+            return --refCount == 0;
+        }
+
+        [[nodiscard]] auto tryIncrease() const noexcept -> bool
+        {
+            if (refCount == 0) {
+                return false;
+            }
+
+            ++refCount;
+            return true;
+        }
+
+        auto increaseWeak() const noexcept -> void
+        {
+            ++weakCount;
+        }
+
+        [[nodiscard]] auto decreaseWeak() const noexcept -> bool
+        {
+            return --weakCount == 0;
+        }
+
+        [[nodiscard]] auto useCount() const noexcept -> std::size_t
+        {
+            return refCount;
+        }
+    };
+
+    template <>
+    class RefCounter<RefCountPolicy::ATOMIC>
+    {
+    private:
+        mutable std::atomic<std::size_t> refCount{1};
+        mutable std::atomic<std::size_t> weakCount{1};
+
+    public:
+        RefCounter() = default;
+
+        auto increase() const noexcept -> void
+        {
+            refCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto decrease() const noexcept -> bool
+        {
+            return refCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        [[nodiscard]] auto tryIncrease() const noexcept -> bool
+        {
+            auto count = refCount.load(std::memory_order_relaxed);
+
+            do {
+                if (count == 0) {
+                    return false;
+                }
+            } while (!refCount.compare_exchange_weak(
+                count, count + 1, std::memory_order_acquire, std::memory_order_relaxed));
+
+            return true;
+        }
+
+        auto increaseWeak() const noexcept -> void
+        {
+            weakCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto decreaseWeak() const noexcept -> bool
+        {
+            // without weak references nobody else can observe the counter
+            if (weakCount.load(std::memory_order_acquire) == 1) {
+                return true;
+            }
+
+            return weakCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        [[nodiscard]] auto useCount() const noexcept -> std::size_t
+        {
+            return refCount.load(std::memory_order_relaxed);
+        }
+    };
+
+    namespace detail
+    {
+        // Registers the calling thread as an owner of biased counters, releases frames
+        // that were queued to it by other threads and returns its token.
+        [[nodiscard]] auto registerBiasedOwner() -> u64;
+
+        [[nodiscard]] auto nextBiasedThreadToken() noexcept -> u64;
+
+        auto queueBiasedRelease(const RefCounter<RefCountPolicy::BIASED> *counter) -> void;
+
+        inline thread_local const u64 CurrentBiasedThreadToken = nextBiasedThreadToken();
+    } // namespace detail
+
+    // Releases frames whose last references were dropped by threads other than their owner.
+    // Owners also do it every time they create a new biased frame and when they exit.
+    auto processDeferredBiasedReleases() -> void;
+
+    // Biased reference counting (Choi, Shull, Torrellas): the thread that created the
+    // object updates a plain counter, every other thread uses an atomic one. Once the
+    // owner drops its last reference the counters are merged and the atomic counter
+    // becomes authoritative. When a non-owner observes a negative shared count, it
+    // cannot tell whether the object is dead, so the counter is queued to the owner,
+    // which merges it later (or immediately if the owner has already exited).
+    template <>
+    class RefCounter<RefCountPolicy::BIASED>
+    {
+    public:
+        using Releaser = void (*)(void *);
+
+    private:
+        static constexpr std::intptr_t mergedFlag = 1;
+        static constexpr std::intptr_t queuedFlag = 2;
+        static constexpr std::intptr_t sharedOne = 4;
+
+        u64 ownerToken{detail::registerBiasedOwner()};
+        mutable std::size_t biasedCount{1};
+        mutable std::atomic<std::intptr_t> sharedCount{0};
+        mutable bool mergedByOwner{false};
+        Releaser releaser{};
+
+    public:
+        RefCounter() = default;
+
+        auto setReleaser(const Releaser releaser_function) noexcept -> void
+        {
+            releaser = releaser_function;
+        }
+
+        auto increase() const noexcept -> void
+        {
+            if (isOwnedByCurrentThread()) {
+                ++biasedCount;
+                return;
+            }
+
+            sharedCount.fetch_add(sharedOne, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] auto decrease() const -> bool
+        {
+            if (!isOwnedByCurrentThread()) {
+                return decreaseShared();
+            }
+
+            if (--biasedCount != 0) {
+                return false;
+            }
+
+            mergedByOwner = true;
+            const auto old_value = sharedCount.fetch_or(mergedFlag, std::memory_order_acq_rel);
+
+            return isLastReference(old_value);
+        }
+
+        // Called by the owner while draining its queue or by a non-owner after the owner
+        // exited. In both cases owner's plain counter is safe to read.
+        auto mergeQueued() const -> void
+        {
+            auto delta = -queuedFlag;
+
+            if (!mergedByOwner) {
+                delta += static_cast<std::intptr_t>(biasedCount) * sharedOne + mergedFlag;
+                biasedCount = 0;
+                mergedByOwner = true;
+            }
+
+            const auto new_value =
+                sharedCount.fetch_add(delta, std::memory_order_acq_rel) + delta;
+
+            if (isLastReference(new_value)) {
+                releaser(const_cast<RefCounter *>(this)); // NOLINT
+            }
+        }
+
+        [[nodiscard]] auto getOwnerToken() const noexcept -> u64
+        {
+            return ownerToken;
+        }
+
+    private:
+        [[nodiscard]] auto isOwnedByCurrentThread() const noexcept -> bool
+        {
+            // the token is checked first, so only the owner reads its plain fields
+            return ownerToken == detail::CurrentBiasedThreadToken && !mergedByOwner;
+        }
+
+        ISL_DECL static auto isLastReference(const std::intptr_t value) noexcept -> bool
+        {
+            return (value >> 2) == 0 && (value & queuedFlag) == 0;
+        }
+
+        [[nodiscard]] auto decreaseShared() const -> bool
+        {
+            auto old_value = sharedCount.load(std::memory_order_relaxed);
+            auto new_value = std::intptr_t{};
+
+            do {
+                new_value = old_value - sharedOne;
+
+                if (new_value < 0 && (new_value & (mergedFlag | queuedFlag)) == 0) {
+                    new_value |= queuedFlag;
+                }
+            } while (!sharedCount.compare_exchange_weak(
+                old_value, new_value, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+            if ((new_value & mergedFlag) != 0) {
+                return isLastReference(new_value);
+            }
+
+            if ((old_value & queuedFlag) == 0 && (new_value & queuedFlag) != 0) {
+                detail::queueBiasedRelease(this);
+            }
+
+            return false;
+        }
+    };
+} // namespace isl
+
+#endif /* ISL_PROJECT_REF_COUNTER_HPP */
@@ -1,139 +1,293 @@
 #ifndef ISL_SMALL_FUNCTION_HPP
 #define ISL_SMALL_FUNCTION_HPP
 
+#include <cstring>
 #include <isl/isl.hpp>
 #include <type_traits>
 
 namespace isl
 {
-    template <typename T, std::size_t N = sizeof(std::size_t) * 4>
-    class SmallFunction;
+    // Passing &isl::HeapFallback as FallbackAllocator makes SmallFunction store callables,
+    // which do not fit into its buffer, on the heap. A pointer to a global allocator
+    // (PoolAllocator for example) can be used instead.
+    struct HeapFallbackTag
+    {
+        template <typename T>
+        ISL_DECL static auto canAllocate() noexcept -> bool
+        {
+            return true;
+        }
+    };
+
+    inline constexpr auto HeapFallback = HeapFallbackTag{};
 
-    template <typename Ret, typename... Args, std::size_t N>
-    class SmallFunction<Ret(Args...), N>
+    namespace detail
     {
-        struct InvokerBase
+        template <bool Copyable, typename T, std::size_t N, auto FallbackAllocator>
+        class BasicSmallFunction;
+
+        template <
+            bool Copyable, typename Ret, typename... Args, std::size_t N, auto FallbackAllocator>
+        class BasicSmallFunction<Copyable, Ret(Args...), N, FallbackAllocator>
         {
-            InvokerBase() = default;
+            // Calls go through a single pointer stored next to the buffer. Lifetime
+            // operations are shared by all functions storing the same callable type and are
+            // absent for trivially copyable callables, which are copied with memcpy.
+            using InvokerFunction = Ret (*)(const void *storage, Args &&...args);
 
-            InvokerBase(const InvokerBase &) = delete;
+            struct Operations
+            {
+                void (*moveConstruct)(void *destination, void *source) noexcept;
+                void (*copyConstruct)(void *destination, const void *source);
+                void (*destroy)(void *storage) noexcept;
+            };
 
-            InvokerBase(InvokerBase &&) = delete;
+            static constexpr bool usesHeapFallback =
+                std::same_as<decltype(FallbackAllocator), const HeapFallbackTag *>;
 
-            virtual ~InvokerBase() = default;
+            static constexpr bool hasFallback =
+                !std::is_null_pointer_v<decltype(FallbackAllocator)>;
 
-            auto operator=(const InvokerBase &) -> InvokerBase & = delete;
+            // Move-only functions promise noexcept moves, so callables which may throw while
+            // being moved are kept out of line.
+            template <typename T>
+            static constexpr bool storedInline =
+                sizeof(T) <= N && alignof(T) <= alignof(std::max_align_t)
+                && (Copyable || std::is_nothrow_move_constructible_v<T>);
 
-            auto operator=(InvokerBase &&) -> InvokerBase & = delete;
+            template <typename T>
+            static constexpr bool storedOutOfLine = [] {
+                if constexpr (hasFallback) {
+                    return FallbackAllocator->template canAllocate<T>();
+                } else {
+                    return false;
+                }
+            }();
 
-            ISL_DECL virtual auto invoke(Args &&...args) const -> Ret = 0;
+            static_assert(!hasFallback || sizeof(void *) <= N);
 
-            constexpr virtual auto moveConstruct(void *destination) -> void = 0;
+            template <typename T>
+            struct Inline
+            {
+                static auto get(const void *storage) noexcept -> T *
+                {
+                    // the callable is mutable, as it was in std::function
+                    return static_cast<T *>(const_cast<void *>(storage)); // NOLINT
+                }
 
-            constexpr virtual auto copyConstruct(void *destination) const -> void = 0;
-        };
+                static auto invoke(const void *storage, Args &&...args) -> Ret
+                {
+                    return (*get(storage))(std::forward<Args>(args)...);
+                }
 
-        template <typename T>
-        struct Invoker final : InvokerBase
-        {
-            mutable T function;
+                static constexpr auto operations = Operations{
+                    .moveConstruct =
+                        [](void *destination, void *source) noexcept {
+                            std::construct_at(
+                                static_cast<T *>(destination),
+                                std::move(*static_cast<T *>(source)));
+                        },
+                    .copyConstruct = [](void *destination, const void *source) {
+                        if constexpr (Copyable) {
+                            std::construct_at(
+                                static_cast<T *>(destination), *static_cast<const T *>(source));
+                        } else {
+                            isl::unreachable();
+                        }
+                    },
+                    .destroy = [](void *storage) noexcept { std::destroy_at(get(storage)); },
+                };
+            };
+
+            // The buffer holds a pointer to the callable stored in the fallback allocator,
+            // moving it only moves the pointer.
+            template <typename T>
+            struct OutOfLine
+            {
+                static auto get(const void *storage) noexcept -> T *&
+                {
+                    return *static_cast<T **>(const_cast<void *>(storage)); // NOLINT
+                }
+
+                template <typename... Ts>
+                [[nodiscard]] static auto create(Ts &&...args) -> T *
+                {
+                    if constexpr (usesHeapFallback) {
+                        return ::new T(std::forward<Ts>(args)...);
+                    } else {
+                        auto *memory = static_cast<T *>(FallbackAllocator->allocate());
+                        return std::construct_at(memory, std::forward<Ts>(args)...);
+                    }
+                }
 
-            explicit constexpr Invoker(T function)
-              : function{std::move(function)}
-            {}
+                static auto invoke(const void *storage, Args &&...args) -> Ret
+                {
+                    return (*get(storage))(std::forward<Args>(args)...);
+                }
 
-            ISL_DECL auto invoke(Args &&...args) const -> Ret override
+                static constexpr auto operations = Operations{
+                    .moveConstruct =
+                        [](void *destination, void *source) noexcept {
+                            get(destination) = std::exchange(get(source), nullptr);
+                        },
+                    .copyConstruct = [](void *destination, const void *source) {
+                        if constexpr (Copyable) {
+                            get(destination) = create(*get(source));
+                        } else {
+                            isl::unreachable();
+                        }
+                    },
+                    .destroy = [](void *storage) noexcept {
+                        auto *function = get(storage);
+
+                        if (function == nullptr) {
+                            return;
+                        }
+
+                        if constexpr (usesHeapFallback) {
+                            ::delete function;
+                        } else {
+                            std::destroy_at(function);
+                            FallbackAllocator->deallocate(static_cast<void *>(function));
+                        }
+                    },
+                };
+            };
+
+            // NOLINTNEXTLINE (modernize-avoid-c-arrays)
+            alignas(std::max_align_t) std::byte smallStorage[N];
+            InvokerFunction invoker;
+            const Operations *operations;
+
+        public:
+            template <typename F>
+            requires(
+                std::invocable<F, Args...>
+                && !std::is_same_v<std::remove_cvref_t<F>, BasicSmallFunction>
+                && (!Copyable || std::is_copy_constructible_v<std::remove_cvref_t<F>>))
+            // NOLINTNEXTLINE (cppcoreguidelines-pro-type-member-init)
+            BasicSmallFunction(F &&function)
+                requires(
+                    storedInline<std::remove_cvref_t<F>>
+                    || storedOutOfLine<std::remove_cvref_t<F>>)
             {
-                return function(std::forward<Args>(args)...);
+                using Callable = std::remove_cvref_t<F>;
+
+                if constexpr (storedInline<Callable>) {
+                    std::construct_at(
+                        static_cast<Callable *>(static_cast<void *>(smallStorage)),
+                        std::forward<F>(function));
+
+                    invoker = &Inline<Callable>::invoke;
+                    operations = std::is_trivially_copyable_v<Callable>
+                                     ? nullptr
+                                     : std::addressof(Inline<Callable>::operations);
+                } else {
+                    OutOfLine<Callable>::get(smallStorage) =
+                        OutOfLine<Callable>::create(std::forward<F>(function));
+
+                    invoker = &OutOfLine<Callable>::invoke;
+                    operations = std::addressof(OutOfLine<Callable>::operations);
+                }
             }
 
-            constexpr auto moveConstruct(void *destination) -> void override
+            // NOLINTNEXTLINE (cppcoreguidelines-pro-type-member-init)
+            BasicSmallFunction(const BasicSmallFunction &other)
+                requires(Copyable)
             {
-                new (destination) Invoker{std::move(function)};
+                copyFrom(other);
             }
 
-            constexpr auto copyConstruct(void *destination) const -> void override
+            // NOLINTNEXTLINE (cppcoreguidelines-pro-type-member-init)
+            BasicSmallFunction(BasicSmallFunction &&other) noexcept
             {
-                new (destination) Invoker{function};
+                moveFrom(other);
             }
-        };
 
-        std::byte smallStorage[N]; // NOLINT (modernize-avoid-c-arrays)
+            ~BasicSmallFunction()
+            {
+                destroy();
+            }
 
-    public:
-        template <typename F>
-        requires(
-            std::invocable<F, Args...> && !std::is_same_v<std::remove_cvref_t<F>, SmallFunction>)
-        ISL_DECL SmallFunction(F &&function)
-            requires(sizeof(Invoker<std::remove_cvref_t<F>>) <= sizeof(smallStorage))
-        {
-            new (smallStorage) Invoker<std::remove_cvref_t<F>>{std::forward<F>(function)};
-        }
+            auto operator=(const BasicSmallFunction &other) -> BasicSmallFunction &
+                requires(Copyable)
+            {
+                if (this == &other) {
+                    return *this;
+                }
 
-        // NOLINTNEXTLINE (cppcoreguidelines-pro-type-member-init)
-        ISL_DECL SmallFunction(const SmallFunction &other)
-        {
-            other.getInvokerBase()->copyConstruct(smallStorage);
-        }
+                destroy();
+                copyFrom(other);
 
-        // NOLINTNEXTLINE (cppcoreguidelines-pro-type-member-init)
-        ISL_DECL SmallFunction(SmallFunction &&other) noexcept
-        {
-            other.getInvokerBase()->moveConstruct(smallStorage);
-        }
+                return *this;
+            }
 
-        constexpr ~SmallFunction()
-        {
-            std::destroy_at(getInvokerBase());
-        }
+            auto operator=(BasicSmallFunction &&other) noexcept -> BasicSmallFunction &
+            {
+                if (this == &other) {
+                    return *this;
+                }
+
+                destroy();
+                moveFrom(other);
 
-        constexpr auto operator=(const SmallFunction &other) -> SmallFunction &
-        {
-            if (this == &other) {
                 return *this;
             }
 
-            std::destroy_at(getInvokerBase());
-            other.getInvokerBase()->copyConstruct(smallStorage);
+            template <typename... InvokeArgs> // NOLINTNEXTLINE
+                                              // (cppcoreguidelines-missing-std-forward)
+            ISL_INLINE auto operator()(InvokeArgs &&...args) const -> Ret
+                requires(
+                    sizeof...(InvokeArgs) == sizeof...(Args)
+                    && std::invocable<Ret(Args...), decltype(static_cast<Args>(args))...>)
+            {
+                return invoker(smallStorage, static_cast<Args>(args)...);
+            }
 
-            return *this;
-        }
+        private:
+            auto copyFrom(const BasicSmallFunction &other) -> void
+            {
+                if (other.operations == nullptr) {
+                    std::memcpy(smallStorage, other.smallStorage, N);
+                } else {
+                    other.operations->copyConstruct(smallStorage, other.smallStorage);
+                }
 
-        constexpr auto operator=(SmallFunction &&other) noexcept -> SmallFunction &
-        {
-            if (this == &other) {
-                return *this;
+                invoker = other.invoker;
+                operations = other.operations;
             }
 
-            std::destroy_at(getInvokerBase());
-            other.getInvokerBase()->moveConstruct(smallStorage);
+            auto moveFrom(BasicSmallFunction &other) noexcept -> void
+            {
+                if (other.operations == nullptr) {
+                    std::memcpy(smallStorage, other.smallStorage, N);
+                } else {
+                    other.operations->moveConstruct(smallStorage, other.smallStorage);
+                }
 
-            return *this;
-        }
+                invoker = other.invoker;
+                operations = other.operations;
+            }
 
-        template <typename... InvokeArgs> // NOLINTNEXTLINE
-                                          // (cppcoreguidelines-missing-std-forward)
-        ISL_DECL auto operator()(InvokeArgs &&...args) const -> Ret
-            requires(
-                sizeof...(InvokeArgs) == sizeof...(Args)
-                && std::invocable<Ret(Args...), decltype(static_cast<Args>(args))...>)
-        {
-            return getInvokerBase()->invoke(static_cast<Args>(args)...);
-        }
+            auto destroy() noexcept -> void
+            {
+                if (operations != nullptr) {
+                    operations->destroy(smallStorage);
+                }
+            }
+        };
+    } // namespace detail
 
-    private:
-        ISL_DECL auto getInvokerBase() noexcept -> InvokerBase *
-        {
-            // NOLINTNEXTLINE (cppcoreguidelines-pro-type-reinterpret-cast)
-            return reinterpret_cast<InvokerBase *>(&smallStorage[0]);
-        }
+    // Callables larger than N bytes are rejected at compile time unless FallbackAllocator
+    // is set (see isl::HeapFallback).
+    template <
+        typename T, std::size_t N = sizeof(std::size_t) * 4, auto FallbackAllocator = nullptr>
+    using SmallFunction = detail::BasicSmallFunction<true, T, N, FallbackAllocator>;
 
-        ISL_DECL auto getInvokerBase() const noexcept -> const InvokerBase *
-        {
-            // NOLINTNEXTLINE (cppcoreguidelines-pro-type-reinterpret-cast)
-            return reinterpret_cast<const InvokerBase *>(&smallStorage[0]);
-        }
-    };
+    // Accepts move-only callables, moving the function never throws.
+    template <
+        typename T, std::size_t N = sizeof(std::size_t) * 4, auto FallbackAllocator = nullptr>
+    using SmallMoveOnlyFunction = detail::BasicSmallFunction<false, T, N, FallbackAllocator>;
 } // namespace isl
 
 #endif /* ISL_SMALL_FUNCTION_HPP */
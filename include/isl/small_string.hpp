@@ -0,0 +1,275 @@
+#ifndef ISL_PROJECT_SMALL_STRING_HPP
+#define ISL_PROJECT_SMALL_STRING_HPP
+
+#include <isl/small_vector.hpp>
+#include <isl/string_view.hpp>
+#include <isl/utf8.hpp>
+
+namespace isl
+{
+    // String stored in SmallVector: up to N characters live inline, longer strings are
+    // allocated. The string is not null terminated, use it through BasicStringView.
+    template <
+        CharacterLiteral CharT, u32 N = 24, typename Allocator = std::allocator<CharT>,
+        std::unsigned_integral SizeType = u32>
+    class BasicSmallString
+    {
+    private:
+        using Storage = SmallVector<CharT, N, Allocator, SmallVectorGrowth<>, SizeType>;
+
+        Storage characters;
+
+    public:
+        using value_type = CharT;
+        using size_type = SizeType;
+        using iterator = CharT *;
+        using const_iterator = const CharT *;
+        using view_type = BasicStringView<CharT>;
+
+        BasicSmallString() = default;
+
+        // NOLINTNEXTLINE
+        BasicSmallString(const view_type str)
+        {
+            append(str);
+        }
+
+        // NOLINTNEXTLINE
+        BasicSmallString(const CharT *str)
+          : BasicSmallString{view_type{str}}
+        {}
+
+        BasicSmallString(const CharT *str, const std::size_t length)
+          : BasicSmallString{view_type{str, length}}
+        {}
+
+        explicit BasicSmallString(const std::basic_string_view<CharT> str)
+          : BasicSmallString{view_type{str.data(), str.size()}}
+        {}
+
+        [[nodiscard]] auto size() const noexcept -> size_type
+        {
+            return characters.size();
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> bool
+        {
+            return characters.empty();
+        }
+
+        [[nodiscard]] auto capacity() const noexcept -> size_type
+        {
+            return characters.capacity();
+        }
+
+        [[nodiscard]] auto data() noexcept -> CharT *
+        {
+            return characters.data();
+        }
+
+        [[nodiscard]] auto data() const noexcept -> const CharT *
+        {
+            return characters.data();
+        }
+
+        [[nodiscard]] auto begin() noexcept -> iterator
+        {
+            return characters.begin();
+        }
+
+        [[nodiscard]] auto begin() const noexcept -> const_iterator
+        {
+            return characters.begin();
+        }
+
+        [[nodiscard]] auto end() noexcept -> iterator
+        {
+            return characters.end();
+        }
+
+        [[nodiscard]] auto end() const noexcept -> const_iterator
+        {
+            return characters.end();
+        }
+
+        auto operator[](const size_type index) -> CharT &
+        {
+            return characters[index];
+        }
+
+        auto operator[](const size_type index) const -> CharT
+        {
+            return characters[index];
+        }
+
+        [[nodiscard]] auto view() const noexcept -> view_type
+        {
+            return {data(), size()};
+        }
+
+        // NOLINTNEXTLINE
+        [[nodiscard]] operator view_type() const noexcept
+        {
+            return view();
+        }
+
+        [[nodiscard]] explicit operator std::basic_string_view<CharT>() const noexcept
+        {
+            return {data(), size()};
+        }
+
+        [[nodiscard]] explicit operator std::basic_string<CharT>() const
+        {
+            return {data(), size()};
+        }
+
+        auto reserve(const size_type new_capacity) -> void
+        {
+            characters.reserve(new_capacity);
+        }
+
+        auto resize(const size_type new_size, const CharT chr = CharT{}) -> void
+        {
+            characters.resize(new_size, chr);
+        }
+
+        auto shrink_to_fit() -> void
+        {
+            characters.shrink_to_fit();
+        }
+
+        auto clean() -> void
+        {
+            characters.clean();
+        }
+
+        auto push_back(const CharT chr) -> void
+        {
+            characters.emplace_back(chr);
+        }
+
+        auto pop_back() -> void
+        {
+            characters.pop_back();
+        }
+
+        auto append(const view_type str) -> BasicSmallString &
+        {
+            characters.append(str.begin(), str.end());
+            return *this;
+        }
+
+        auto append(const CharT chr) -> BasicSmallString &
+        {
+            characters.emplace_back(chr);
+            return *this;
+        }
+
+        // Encodes code point as UTF-8, throws std::invalid_argument for values above U+10FFFF.
+        auto appendCodePoint(const char32_t chr) -> BasicSmallString &
+            requires(sizeof(CharT) == 1)
+        {
+            utf8::appendUtf32ToUtf8Container(std::back_inserter(*this), chr);
+            return *this;
+        }
+
+        auto operator+=(const view_type str) -> BasicSmallString &
+        {
+            return append(str);
+        }
+
+        auto operator+=(const CharT chr) -> BasicSmallString &
+        {
+            return append(chr);
+        }
+
+        [[nodiscard]] auto operator==(const BasicSmallString &other) const noexcept -> bool
+        {
+            return asStdView() == other.asStdView();
+        }
+
+        template <std::convertible_to<view_type> T>
+        requires(!std::same_as<T, BasicSmallString>)
+        [[nodiscard]] auto operator==(const T &other) const noexcept -> bool
+        {
+            return asStdView() == toStdView(static_cast<view_type>(other));
+        }
+
+        [[nodiscard]] auto operator<=>(const BasicSmallString &other) const noexcept
+            -> std::strong_ordering
+        {
+            return asStdView() <=> other.asStdView();
+        }
+
+        template <std::convertible_to<view_type> T>
+        requires(!std::same_as<T, BasicSmallString>)
+        [[nodiscard]] auto operator<=>(const T &other) const noexcept -> std::strong_ordering
+        {
+            return asStdView() <=> toStdView(static_cast<view_type>(other));
+        }
+
+    private:
+        [[nodiscard]] auto asStdView() const noexcept -> std::basic_string_view<CharT>
+        {
+            return {data(), size()};
+        }
+
+        [[nodiscard]] static auto toStdView(const view_type str) noexcept
+            -> std::basic_string_view<CharT>
+        {
+            return {str.data(), str.size()};
+        }
+    };
+
+    using SmallString = BasicSmallString<char>;
+    using SmallU8String = BasicSmallString<char8_t>;
+    using SmallU16String = BasicSmallString<char16_t>;
+    using SmallU32String = BasicSmallString<char32_t>;
+} // namespace isl
+
+template <isl::CharacterLiteral CharT, isl::u32 N, typename Allocator, typename SizeType>
+struct ankerl::unordered_dense::hash<isl::BasicSmallString<CharT, N, Allocator, SizeType>>
+{
+    using is_transparent = void;
+    using is_avalanching = void;
+
+    [[nodiscard]] auto operator()(const isl::BasicStringView<CharT> &str) const noexcept -> auto
+    {
+        return hash<isl::BasicStringView<CharT>>{}(str);
+    }
+};
+
+namespace isl
+{
+    // Compares small strings and views by their characters. Together with the transparent hash
+    // it lets maps find small strings by views without building temporary strings.
+    template <CharacterLiteral CharT>
+    struct SmallStringEqual
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] auto operator()(
+            const BasicStringView<CharT> &lhs, const BasicStringView<CharT> &rhs) const noexcept
+            -> bool
+        {
+            return lhs == rhs;
+        }
+    };
+
+    template <typename Value, typename String = SmallString>
+    using SmallStringMap = ankerl::unordered_dense::map<
+        String, Value, ankerl::unordered_dense::hash<String>,
+        SmallStringEqual<typename String::value_type>>;
+} // namespace isl
+
+template <>
+struct fmt::formatter<isl::SmallString> : formatter<std::string_view>
+{
+    auto format(const isl::SmallString &str, format_context &ctx) const
+        -> format_context::iterator
+    {
+        return formatter<std::string_view>::format(static_cast<std::string_view>(str), ctx);
+    }
+};
+
+#endif /* ISL_PROJECT_SMALL_STRING_HPP */
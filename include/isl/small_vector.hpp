@@ -1,27 +1,56 @@
 #ifndef ISL_PROJECT_SMALL_VECTOR_HPP
 #define ISL_PROJECT_SMALL_VECTOR_HPP
 
+#include <cstring>
 #include <isl/isl.hpp>
+#include <limits>
+#include <stdexcept>
 
 namespace isl
 {
-    template <typename T, u32 N, typename Allocator = std::allocator<T>>
+    // Capacity of a full vector is multiplied by Numerator / Denominator.
+    template <u32 Numerator = 2, u32 Denominator = 1>
+    requires(Denominator != 0 && Numerator > Denominator)
+    struct SmallVectorGrowth
+    {
+        ISL_DECL static auto grow(const std::size_t capacity, const std::size_t required) noexcept
+            -> std::size_t
+        {
+            return std::max({capacity * Numerator / Denominator, capacity + 1, required});
+        }
+    };
+
+    // Trivially relocatable elements (see isl::IsTriviallyRelocatable) are moved between
+    // buffers with memcpy. Range operations reserve memory once when the size of the range
+    // is known. As in std::vector, ranges passed to insert, append and assign must not refer
+    // to elements of the vector itself.
+    // SizeType limits both size and capacity: u8 and u16 pack tiny vectors into hot
+    // structures, u64 allows more than 4G elements. The pointer to allocated memory shares
+    // bytes with the inline elements and is not padded to pointer alignment, so
+    // SmallVector<char, 22, std::allocator<char>, SmallVectorGrowth<>, u8> takes 24 bytes.
+    template <
+        typename T, u32 N, typename Allocator = std::allocator<T>,
+        typename Growth = SmallVectorGrowth<>, std::unsigned_integral SizeType = u32>
+    requires(N != 0 && N <= std::numeric_limits<SizeType>::max())
     class SmallVector
     {
     private:
-        union {
-            T *largeStorage = nullptr;
-            std::array<T, N> smallStorage;
-        };
+        using AllocatorTraits = std::allocator_traits<Allocator>;
+
+        static constexpr bool triviallyRelocatable = IsTriviallyRelocatable<T>;
 
-        u32 vectorSize{};
-        u32 vectorCapacity{N};
-        Allocator allocator;
+        static constexpr std::size_t storageSize = std::max(sizeof(T) * N, sizeof(T *));
+
+        // NOLINTNEXTLINE (modernize-avoid-c-arrays)
+        alignas(T) std::byte storage[storageSize];
+        SizeType vectorSize{};
+        SizeType vectorCapacity{N};
+        ISL_NO_UNIQUE_ADDRESS Allocator allocator;
 
     public:
         using value_type = T;
         using allocator_type = Allocator;
-        using size_type = u32;
+        using size_type = SizeType;
         using difference_type = std::ptrdiff_t;
         using reference = T &;
         using const_reference = const T &;
@@ -34,193 +63,74 @@ namespace isl
 
         SmallVector(const std::initializer_list<T> &initializer_list)
         {
-            reserve(static_cast<u32>(initializer_list.size()));
-
-            for (const auto &element : initializer_list) {
-                emplace_back(element);
-            }
+            append(initializer_list);
         }
 
-        SmallVector(const SmallVector &other)
-          : vectorSize{other.vectorSize}
-          , allocator{other.allocator}
+        explicit SmallVector(const size_type count)
         {
-            T *buffer = nullptr;
-
-            if (vectorSize <= N) {
-                vectorCapacity = N;
-                buffer = std::addressof(smallStorage[0]);
-            } else {
-                vectorCapacity = vectorSize;
-                buffer = std::allocator_traits<Allocator>::allocate(allocator, vectorSize);
-                largeStorage = buffer;
-            }
+            resize(count);
+        }
 
-            const auto *buffer_end = buffer + vectorSize;
-            const auto *other_buffer = other.data();
+        SmallVector(const size_type count, const T &value)
+        {
+            resize(count, value);
+        }
 
-            while (buffer != buffer_end) {
-                std::construct_at(buffer, *other_buffer);
-                ++buffer;
-                ++other_buffer;
-            }
+        SmallVector(const SmallVector &other)
+          : allocator{AllocatorTraits::select_on_container_copy_construction(other.allocator)}
+        {
+            append(other);
         }
 
         SmallVector(SmallVector &&other) noexcept
-          : vectorSize{std::exchange(other.vectorSize, 0)}
-          , allocator{other.allocator}
+          : allocator{other.allocator}
         {
-            if (other.capacity() > N) {
-                largeStorage = std::exchange(other.largeStorage, nullptr);
-                vectorCapacity = std::exchange(other.vectorCapacity, N);
-                return;
-            }
-
-            vectorCapacity = N;
-            auto *buffer = std::addressof(smallStorage[0]);
-            const auto *buffer_end = buffer + vectorSize;
-            auto *other_buffer = other.data();
-
-            while (buffer != buffer_end) {
-                std::construct_at(buffer, std::move(*other_buffer));
-                std::destroy_at(other_buffer);
-                ++buffer;
-                ++other_buffer;
-            }
-
-            other.vectorSize = 0;
+            stealFrom(other);
         }
 
         ~SmallVector()
         {
-            auto [buffer, is_internal] = dataWithBufferInfo();
-            cleanBuffer(buffer, buffer + vectorSize, is_internal);
+            destroyAndDeallocate();
         }
 
         auto operator=(const SmallVector &other) -> SmallVector &
         {
-            if (this == std::addressof(other)) {
-                return *this;
-            }
-
-            if (capacity() >= other.size()) {
-                auto *buffer = data();
-                const auto *buffer_end = buffer + vectorSize;
-                auto *other_buffer = other.data();
-                const auto *other_buffer_end = other_buffer + other.vectorSize;
-
-                while (buffer != buffer_end && other_buffer != other_buffer_end) {
-                    *buffer = *other_buffer;
-                    ++buffer;
-                    ++other_buffer;
-                }
-
-                if (vectorSize > other.vectorSize) {
-                    while (buffer != buffer_end) {
-                        std::destroy_at(buffer);
-                        ++buffer;
-                    }
-
-                    vectorSize = other.vectorSize;
-                    return *this;
-                }
-
-                while (other_buffer != other_buffer_end) {
-                    std::construct_at(buffer, *other_buffer);
-                    ++buffer;
-                    ++other_buffer;
-                }
-
-                vectorSize = other.vectorSize;
-                return *this;
+            if (this != std::addressof(other)) {
+                assign(other.begin(), other.end());
             }
 
-            auto *new_buffer =
-                std::allocator_traits<Allocator>::allocate(allocator, other.vectorSize);
-
-            auto *buffer_it = new_buffer;
-            auto *buffer_end = new_buffer + other.vectorSize;
-            auto *other_buffer_it = other.largeStorage;
-
-            while (buffer_it != buffer_end) {
-                std::construct_at(buffer_it, *other_buffer_it);
-                ++buffer_it;
-                ++other_buffer_it;
-            }
-
-            largeStorage = new_buffer;
-            vectorSize = other.vectorSize;
-            vectorCapacity = vectorSize;
             return *this;
         }
 
         auto operator=(SmallVector &&other) noexcept -> SmallVector &
         {
-            swap(other);
+            if (this == std::addressof(other)) {
+                return *this;
+            }
+
+            destroyAndDeallocate();
+            vectorSize = 0;
+            vectorCapacity = N;
+            stealFrom(other);
+
             return *this;
         }
 
         auto swap(SmallVector &other) noexcept -> void
         {
-            if (capacity() > N && other.capacity() > N) {
-                std::swap(largeStorage, other.largeStorage);
+            if (!isInternal() && !other.isInternal()) {
+                auto *large_storage = getLargeStorage();
+                setLargeStorage(other.getLargeStorage());
+                other.setLargeStorage(large_storage);
                 std::swap(vectorSize, other.vectorSize);
                 std::swap(vectorCapacity, other.vectorCapacity);
                 return;
             }
 
-            if (capacity() <= N && other.capacity() <= N) {
-                auto *buffer = std::addressof(smallStorage[0]);
-                auto *other_buffer = std::addressof(other.smallStorage[0]);
-                auto *buffer_end = buffer + vectorSize;
-                auto *other_buffer_end = other_buffer + other.vectorSize;
-
-                while (buffer != buffer_end && other_buffer != other_buffer_end) {
-                    std::swap(*buffer, *other_buffer);
-                    ++buffer;
-                    ++other_buffer;
-                }
-
-                if (vectorSize > other.vectorSize) {
-                    while (buffer != buffer_end) {
-                        std::construct_at(other_buffer, std::move(*buffer));
-                        std::destroy_at(buffer);
-                        ++buffer;
-                        ++other_buffer;
-                    }
-
-                    std::swap(vectorSize, other.vectorSize);
-                    return;
-                }
-
-                while (other_buffer != other_buffer_end) {
-                    std::construct_at(buffer, std::move(*other_buffer));
-                    std::destroy_at(other_buffer);
-                    ++buffer;
-                    ++other_buffer;
-                }
-
-                std::swap(vectorSize, other.vectorSize);
-                return;
-            }
-
-            if (capacity() <= N) {
-                other.swap(*this);
-                return;
-            }
-
-            // capacity() > N
-            auto *self_memory = largeStorage;
-            auto *other_buffer = std::addressof(other.smallStorage[0]);
-
-            for (u32 i = 0; i != other.vectorSize; ++i) {
-                std::construct_at(std::addressof(smallStorage[i]), std::move(other_buffer[i]));
-                std::destroy_at(std::addressof(other_buffer[i]));
-            }
-
-            other.largeStorage = self_memory;
-            std::swap(vectorSize, other.vectorSize);
-            std::swap(vectorCapacity, other.vectorCapacity);
+            // at least one of the vectors keeps at most N elements, relocate them
+            auto temporary = std::move(other);
+            other = std::move(*this);
+            *this = std::move(temporary);
         }
 
         [[nodiscard]] auto operator==(const SmallVector &other) const -> bool
@@ -246,7 +156,7 @@ namespace isl
             auto *buffer = data();
             auto *other_buffer = other.data();
 
-            for (u32 i = 0; i != vectorSize && i != other.vectorSize; ++i) {
+            for (std::size_t i = 0; i != vectorSize && i != other.vectorSize; ++i) {
                 if (const auto cmp = buffer[i] <=> other_buffer[i]; cmp != 0) {
                     return cmp;
                 }
@@ -275,17 +185,17 @@ namespace isl
             return *(data() + vectorSize - 1);
         }
 
-        auto operator[](const u32 index) -> T &
+        auto operator[](const size_type index) -> T &
         {
             return data()[index];
         }
 
-        auto operator[](const u32 index) const -> const T &
+        auto operator[](const size_type index) const -> const T &
         {
             return data()[index];
         }
 
-        auto at(const u32 index) -> T &
+        auto at(const size_type index) -> T &
         {
             if (index >= vectorSize) {
                 throw std::out_of_range{"SmallVector::at"};
@@ -294,7 +204,7 @@ namespace isl
             return operator[](index);
         }
 
-        auto at(const u32 index) const -> const T &
+        auto at(const size_type index) const -> const T &
         {
             if (index >= vectorSize) {
                 throw std::out_of_range{"SmallVector::at"};
@@ -309,29 +219,39 @@ namespace isl
             vectorSize = 0;
         }
 
-        auto erase(iterator it) -> void
+        auto erase(const const_iterator it) -> iterator
         {
-            for (auto *current = it; current != end() - 1; ++current) {
-                *current = std::move(*(current + 1));
+            return erase(it, it + 1);
+        }
+
+        auto erase(const const_iterator first, const const_iterator last) -> iterator
+        {
+            auto *buffer = data();
+            auto *erase_begin = buffer + (first - buffer);
+            auto *erase_end = buffer + (last - buffer);
+            auto *buffer_end = end();
+
+            if constexpr (triviallyRelocatable) {
+                std::destroy(erase_begin, erase_end);
+                relocateBytes(erase_end, buffer_end, erase_begin);
+            } else {
+                auto *new_end = std::move(erase_end, buffer_end, erase_begin);
+                std::destroy(new_end, buffer_end);
             }
 
-            vectorSize -= 1;
+            vectorSize = static_cast<size_type>(vectorSize - (erase_end - erase_begin));
+            return erase_begin;
         }
 
         template <typename... Ts>
         requires(std::constructible_from<T, Ts...>)
         auto emplace_back(Ts &&...args) -> T &
         {
-            T *buffer = nullptr;
-
-            if (vectorSize == vectorCapacity) {
-                reserveNoCheck(vectorCapacity * 2);
-                buffer = largeStorage;
-            } else {
-                buffer = data();
+            if (vectorSize == vectorCapacity) [[unlikely]] {
+                return growAndEmplaceBack(std::forward<Ts>(args)...);
             }
 
-            T *construction_place = buffer + vectorSize;
+            T *construction_place = data() + vectorSize;
             std::construct_at(construction_place, std::forward<Ts>(args)...);
 
             ++vectorSize;
@@ -339,6 +259,152 @@ namespace isl
             return *construction_place;
         }
 
+        template <typename... Ts>
+        requires(std::constructible_from<T, Ts...>)
+        auto emplace(const const_iterator position, Ts &&...args) -> iterator
+        {
+            const auto index = position - cbegin();
+            emplace_back(std::forward<Ts>(args)...);
+
+            auto *buffer = data();
+            std::rotate(buffer + index, buffer + vectorSize - 1, buffer + vectorSize);
+
+            return buffer + index;
+        }
+
+        auto insert(const const_iterator position, const T &value) -> iterator
+        {
+            return emplace(position, value);
+        }
+
+        auto insert(const const_iterator position, T &&value) -> iterator
+        {
+            return emplace(position, std::move(value));
+        }
+
+        auto insert(const const_iterator position, const size_type count, const T &value)
+            -> iterator
+        {
+            const auto index = position - cbegin();
+            const auto old_size = vectorSize;
+
+            // the sum is computed in std::size_t, narrow size types would wrap around
+            resize(checkedCapacity(static_cast<std::size_t>(vectorSize) + count), value);
+
+            auto *buffer = data();
+            std::rotate(buffer + index, buffer + old_size, buffer + vectorSize);
+
+            return buffer + index;
+        }
+
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires(std::constructible_from<T, std::iter_reference_t<It>>)
+        auto insert(const const_iterator position, It first, S last) -> iterator
+        {
+            const auto index = position - cbegin();
+            const auto old_size = vectorSize;
+
+            if constexpr (
+                std::forward_iterator<It> && std::is_trivially_copyable_v<T>
+                && std::is_nothrow_constructible_v<T, std::iter_reference_t<It>>) {
+                // open a gap with a single memmove, copying into it can not throw
+                const auto count = static_cast<std::size_t>(std::ranges::distance(first, last));
+                reserveForAppend(count);
+
+                auto *gap = data() + index;
+                relocateBytes(gap, gap + (old_size - index), gap + count);
+                std::uninitialized_copy_n(std::move(first), count, gap);
+                vectorSize = static_cast<size_type>(vectorSize + count);
+            } else {
+                append(std::move(first), std::move(last));
+
+                auto *buffer = data();
+                std::rotate(buffer + index, buffer + old_size, buffer + vectorSize);
+            }
+
+            return data() + index;
+        }
+
+        auto insert(const const_iterator position, std::initializer_list<T> initializer_list)
+            -> iterator
+        {
+            return insert(position, initializer_list.begin(), initializer_list.end());
+        }
+
+        template <std::ranges::input_range R>
+        auto insert_range(const const_iterator position, R &&range) -> iterator
+        {
+            return insert(position, std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires(std::constructible_from<T, std::iter_reference_t<It>>)
+        auto append(It first, S last) -> void
+        {
+            if constexpr (std::forward_iterator<It>) {
+                const auto count = static_cast<std::size_t>(std::ranges::distance(first, last));
+                reserveForAppend(count);
+
+                std::uninitialized_copy_n(std::move(first), count, end());
+                vectorSize = static_cast<size_type>(vectorSize + count);
+            } else {
+                for (; first != last; ++first) {
+                    emplace_back(*first);
+                }
+            }
+        }
+
+        template <std::ranges::input_range R>
+        requires(std::constructible_from<T, std::ranges::range_reference_t<R>>)
+        auto append(R &&range) -> void
+        {
+            append(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        template <std::input_iterator It, std::sentinel_for<It> S>
+        requires(std::constructible_from<T, std::iter_reference_t<It>>)
+        auto assign(It first, S last) -> void
+        {
+            if constexpr (std::forward_iterator<It>) {
+                const auto count = static_cast<std::size_t>(std::ranges::distance(first, last));
+
+                if (count > vectorCapacity) {
+                    clean();
+                    reallocate(checkedCapacity(count));
+                }
+
+                auto *buffer = data();
+                const auto assigned = std::min<std::size_t>(count, vectorSize);
+                auto copy_result = std::ranges::copy_n(
+                    std::move(first), static_cast<std::ptrdiff_t>(assigned), buffer);
+
+                if (count < vectorSize) {
+                    std::destroy(buffer + count, buffer + vectorSize);
+                } else {
+                    std::uninitialized_copy_n(
+                        std::move(copy_result.in), count - assigned, buffer + assigned);
+                }
+
+                vectorSize = static_cast<size_type>(count);
+            } else {
+                clean();
+                append(std::move(first), std::move(last));
+            }
+        }
+
+        template <std::ranges::input_range R>
+        requires(std::constructible_from<T, std::ranges::range_reference_t<R>>)
+        auto assign(R &&range) -> void
+        {
+            assign(std::ranges::begin(range), std::ranges::end(range));
+        }
+
+        auto assign(const size_type count, const T &value) -> void
+        {
+            clean();
+            resize(count, value);
+        }
+
         auto pop_back() -> void
         {
             if (vectorSize == 0) {
@@ -348,26 +414,89 @@ namespace isl
             std::destroy_at(data() + --vectorSize);
         }
 
-        auto reserve(const u32 new_capacity) -> void
+        auto resize(const size_type new_size) -> void
+        {
+            if (new_size <= vectorSize) {
+                std::destroy(data() + new_size, end());
+                vectorSize = new_size;
+                return;
+            }
+
+            reserveForAppend(new_size - vectorSize);
+            std::uninitialized_value_construct(end(), data() + new_size);
+            vectorSize = new_size;
+        }
+
+        auto resize(const size_type new_size, const T &value) -> void
+        {
+            if (new_size <= vectorSize) {
+                std::destroy(data() + new_size, end());
+                vectorSize = new_size;
+                return;
+            }
+
+            if (new_size > vectorCapacity) {
+                // value may refer to an element of this vector
+                const auto copy = T(value);
+                reserveForAppend(new_size - vectorSize);
+                std::uninitialized_fill(end(), data() + new_size, copy);
+            } else {
+                std::uninitialized_fill(end(), data() + new_size, value);
+            }
+
+            vectorSize = new_size;
+        }
+
+        auto reserve(const size_type new_capacity) -> void
         {
-            if (new_capacity <= N) {
+            if (new_capacity <= vectorCapacity) {
                 return;
             }
 
-            reserveNoCheck(new_capacity);
+            reallocate(new_capacity);
         }
 
-        [[nodiscard]] auto size() const noexcept -> u32
+        auto shrink_to_fit() -> void
+        {
+            if (isInternal() || vectorSize == vectorCapacity) {
+                return;
+            }
+
+            if (vectorSize > N) {
+                reallocate(vectorSize);
+                return;
+            }
+
+            // small storage shares memory with the pointer, so read it first
+            auto *large_buffer = getLargeStorage();
+
+            try {
+                relocate(large_buffer, large_buffer + vectorSize, getSmallStorage());
+            } catch (...) {
+                setLargeStorage(large_buffer);
+                throw;
+            }
+
+            AllocatorTraits::deallocate(allocator, large_buffer, vectorCapacity);
+            vectorCapacity = N;
+        }
+
+        ISL_DECL static auto max_size() noexcept -> size_type
+        {
+            return std::numeric_limits<size_type>::max();
+        }
+
+        [[nodiscard]] auto size() const noexcept -> size_type
         {
             return vectorSize;
         }
 
-        [[nodiscard]] auto empty() const noexcept -> u32
+        [[nodiscard]] auto empty() const noexcept -> bool
         {
             return size() == 0;
         }
 
-        [[nodiscard]] auto capacity() const noexcept -> u32
+        [[nodiscard]] auto capacity() const noexcept -> size_type
         {
             return vectorCapacity;
         }
@@ -405,53 +534,197 @@ namespace isl
         auto data() -> T *
         {
             if (vectorCapacity <= N) {
-                return std::addressof(smallStorage[0]);
+                return getSmallStorage();
             }
 
-            return largeStorage;
+            return getLargeStorage();
         }
 
         auto data() const -> const T *
         {
             if (vectorCapacity <= N) {
-                return std::addressof(smallStorage[0]);
+                return getSmallStorage();
             }
 
-            return largeStorage;
+            return getLargeStorage();
         }
 
     private:
-        auto cleanBuffer(T *buffer_begin, T *buffer_end, const bool is_internal) -> void
+        [[nodiscard]] auto getSmallStorage() const noexcept -> T *
         {
-            std::ranges::destroy(buffer_begin, buffer_end);
+            // NOLINTNEXTLINE (cppcoreguidelines-pro-type-reinterpret-cast)
+            return reinterpret_cast<T *>(const_cast<std::byte *>(storage));
+        }
+
+        [[nodiscard]] auto getLargeStorage() const noexcept -> T *
+        {
+            auto *large_storage = static_cast<T *>(nullptr);
+            std::memcpy(&large_storage, storage, sizeof(T *));
+
+            return large_storage;
+        }
+
+        auto setLargeStorage(T *large_storage) noexcept -> void
+        {
+            std::memcpy(storage, &large_storage, sizeof(T *));
+        }
+
+        [[nodiscard]] auto isInternal() const noexcept -> bool
+        {
+            return vectorCapacity <= N;
+        }
+
+        // Moves elements to uninitialized memory which does not overlap the source, source
+        // elements are destroyed. Elements with a throwing move constructor are copied when
+        // possible. If construction throws, the source is left intact.
+        static auto relocate(T *first, T *last, T *destination) noexcept(
+            triviallyRelocatable || std::is_nothrow_move_constructible_v<T>) -> void
+        {
+            if constexpr (triviallyRelocatable) {
+                relocateBytes(first, last, destination);
+            } else if constexpr (std::is_nothrow_move_constructible_v<T>) {
+                for (; first != last; ++first, ++destination) {
+                    std::construct_at(destination, std::move(*first));
+                    std::destroy_at(first);
+                }
+            } else {
+                auto *constructed = destination;
+
+                try {
+                    for (auto *it = first; it != last; ++it, ++constructed) {
+                        std::construct_at(constructed, std::move_if_noexcept(*it));
+                    }
+                } catch (...) {
+                    std::destroy(destination, constructed);
+                    throw;
+                }
+
+                std::destroy(first, last);
+            }
+        }
+
+        static auto relocateBytes(T *first, T *last, T *destination) noexcept -> void
+        {
+            if (first != last) {
+                // NOLINTNEXTLINE (bugprone-undefined-memory-manipulation)
+                std::memmove(
+                    static_cast<void *>(destination), static_cast<const void *>(first),
+                    static_cast<std::size_t>(last - first) * sizeof(T));
+            }
+        }
+
+        auto stealFrom(SmallVector &other) noexcept -> void
+        {
+            if (!other.isInternal()) {
+                setLargeStorage(other.getLargeStorage());
+                vectorSize = std::exchange(other.vectorSize, 0);
+                vectorCapacity = std::exchange(other.vectorCapacity, N);
+                return;
+            }
+
+            auto *other_storage = other.getSmallStorage();
+            relocate(other_storage, other_storage + other.vectorSize, getSmallStorage());
+            vectorSize = std::exchange(other.vectorSize, 0);
+        }
+
+        auto destroyAndDeallocate() noexcept -> void
+        {
+            auto [buffer, is_internal] = dataWithBufferInfo();
+            std::ranges::destroy(buffer, buffer + vectorSize);
 
             if (!is_internal) {
-                std::allocator_traits<Allocator>::deallocate(
-                    allocator, buffer_begin, vectorCapacity);
+                AllocatorTraits::deallocate(allocator, buffer, vectorCapacity);
             }
         }
 
-        auto reserveNoCheck(const u32 new_capacity) -> void
+        [[nodiscard]] static auto checkedCapacity(const std::size_t required) -> size_type
         {
-            auto *new_memory = std::allocator_traits<Allocator>::allocate(allocator, new_capacity);
+            if (required > max_size()) {
+                throw std::length_error{"SmallVector is too large"};
+            }
+
+            return static_cast<size_type>(required);
+        }
+
+        [[nodiscard]] auto grownCapacity(const std::size_t required) const -> size_type
+        {
+            const auto required_capacity = checkedCapacity(required);
+
+            return static_cast<size_type>(std::min<std::size_t>(
+                Growth::grow(vectorCapacity, required_capacity), max_size()));
+        }
+
+        auto reserveForAppend(const std::size_t count) -> void
+        {
+            const auto required = static_cast<std::size_t>(vectorSize) + count;
+
+            if (required > vectorCapacity) {
+                reallocate(grownCapacity(required));
+            }
+        }
+
+        // New capacity must be greater than N and not less than the size.
+        auto reallocate(const size_type new_capacity) -> void
+        {
+            auto *new_memory = AllocatorTraits::allocate(allocator, new_capacity);
+            auto [buffer, is_internal] = dataWithBufferInfo();
+
+            try {
+                relocate(buffer, buffer + vectorSize, new_memory);
+            } catch (...) {
+                AllocatorTraits::deallocate(allocator, new_memory, new_capacity);
+                throw;
+            }
+
+            if (!is_internal) {
+                AllocatorTraits::deallocate(allocator, buffer, vectorCapacity);
+            }
+
+            setLargeStorage(new_memory);
+            vectorCapacity = new_capacity;
+        }
+
+        // Arguments may refer to elements of this vector, so the new element is constructed
+        // before the old ones are relocated.
+        template <typename... Ts>
+        ISL_NOINLINE auto growAndEmplaceBack(Ts &&...args) -> T &
+        {
+            const auto new_capacity = grownCapacity(static_cast<std::size_t>(vectorSize) + 1);
+            auto *new_memory = AllocatorTraits::allocate(allocator, new_capacity);
+            auto *construction_place = new_memory + vectorSize;
+
+            try {
+                std::construct_at(construction_place, std::forward<Ts>(args)...);
+            } catch (...) {
+                AllocatorTraits::deallocate(allocator, new_memory, new_capacity);
+                throw;
+            }
+
             auto [buffer, is_internal] = dataWithBufferInfo();
 
-            T *buffer_end = buffer + vectorSize;
-            T *new_memory_copy = new_memory;
+            try {
+                relocate(buffer, buffer + vectorSize, new_memory);
+            } catch (...) {
+                std::destroy_at(construction_place);
+                AllocatorTraits::deallocate(allocator, new_memory, new_capacity);
+                throw;
+            }
 
-            for (T *buffer_it = buffer; buffer_it != buffer_end; ++buffer_it, ++new_memory_copy) {
-                std::construct_at(new_memory_copy, std::move(*buffer_it));
+            if (!is_internal) {
+                AllocatorTraits::deallocate(allocator, buffer, vectorCapacity);
             }
 
-            cleanBuffer(buffer, buffer_end, is_internal);
-            largeStorage = new_memory;
+            setLargeStorage(new_memory);
             vectorCapacity = new_capacity;
+            ++vectorSize;
+
+            return *construction_place;
         }
 
         auto dataWithBufferInfo() -> detail::TrivialPair<T *, bool>
         {
             const auto is_internal = vectorCapacity <= N;
-            T *buffer_ptr = is_internal ? std::addressof(smallStorage[0]) : largeStorage;
+            T *buffer_ptr = is_internal ? getSmallStorage() : getLargeStorage();
 
             return {buffer_ptr, is_internal};
         }
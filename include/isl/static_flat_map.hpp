@@ -1,24 +1,142 @@
 #ifndef ISL_PROJECT_FLATMAP_HPP
 #define ISL_PROJECT_FLATMAP_HPP
 
+#include <isl/detail/simd.hpp>
 #include <isl/isl.hpp>
 #include <isl/iterator.hpp>
 
 namespace isl
 {
-    template<typename Key, typename Value, std::size_t Size, typename Pred = std::equal_to<>>
+    enum struct FlatmapLayout : u8
+    {
+        // keys and values are interleaved, iterators point to Pair<Key, Value>
+        ARRAY_OF_STRUCTS,
+        // keys and values are stored in separate arrays, so lookups read only keys
+        STRUCT_OF_ARRAYS,
+    };
+
+    namespace detail
+    {
+        template<typename Key, typename Value, std::size_t Size>
+        struct FlatmapSoaStorage
+        {
+            std::array<Key, Size> keys{};
+            std::array<Value, Size> values{};
+        };
+
+        template<typename Key, typename Value, bool IsConst>
+        class FlatmapSoaIterator
+        {
+        private:
+            template<typename, typename, bool>
+            friend class FlatmapSoaIterator;
+
+            using value_pointer = std::conditional_t<IsConst, const Value *, Value *>;
+
+            const Key *key{};
+            value_pointer value{};
+
+        public:
+            using difference_type = std::ptrdiff_t;
+            using value_type = std::pair<Key, Value>;
+            using reference =
+                std::pair<const Key &, std::conditional_t<IsConst, const Value &, Value &>>;
+            using iterator_category = std::forward_iterator_tag;
+
+            struct pointer
+            {
+                reference ref;
+
+                ISL_DECL auto operator->() noexcept -> reference *
+                {
+                    return &ref;
+                }
+            };
+
+            FlatmapSoaIterator() = default;
+
+            constexpr FlatmapSoaIterator(const Key *key_ptr, const value_pointer value_ptr) noexcept
+              : key{key_ptr}
+              , value{value_ptr}
+            {}
+
+            template<bool OtherIsConst>
+            requires(IsConst && !OtherIsConst)
+            // NOLINTNEXTLINE
+            constexpr FlatmapSoaIterator(
+                const FlatmapSoaIterator<Key, Value, OtherIsConst> &other) noexcept
+              : key{other.key}
+              , value{other.value}
+            {}
+
+            ISL_DECL auto operator*() const noexcept -> reference
+            {
+                return {*key, *value};
+            }
+
+            ISL_DECL auto operator->() const noexcept -> pointer
+            {
+                return {**this};
+            }
+
+            constexpr auto operator++() noexcept -> FlatmapSoaIterator &
+            {
+                ++key;
+                ++value;
+                return *this;
+            }
+
+            constexpr auto operator++(int) noexcept -> FlatmapSoaIterator
+            {
+                auto old = *this;
+                ++*this;
+                return old;
+            }
+
+            ISL_DECL auto operator+(const difference_type offset) const noexcept
+                -> FlatmapSoaIterator
+            {
+                return {key + offset, value + offset};
+            }
+
+            ISL_DECL auto operator==(const FlatmapSoaIterator &other) const noexcept -> bool
+            {
+                return key == other.key;
+            }
+        };
+    }// namespace detail
+
+    template<
+        typename Key, typename Value, std::size_t Size, typename Pred = std::equal_to<>,
+        FlatmapLayout Layout = FlatmapLayout::ARRAY_OF_STRUCTS>
     class StaticFlatmap
-      : public AutoImplementedIteratorMethods<StaticFlatmap<Key, Value, Size, Pred>>
+      : public AutoImplementedIteratorMethods<StaticFlatmap<Key, Value, Size, Pred, Layout>>
     {
     public:
         using key_type = Key;
         using mapped_type = Value;
         using value_type = Pair<Key, Value>;
-        using storage_t = std::array<value_type, Size>;
-        using iterator = typename storage_t::iterator;
-        using const_iterator = typename storage_t::const_iterator;
+
+        static constexpr bool isSoa = Layout == FlatmapLayout::STRUCT_OF_ARRAYS;
+
+        using storage_t = std::conditional_t<
+            isSoa, detail::FlatmapSoaStorage<Key, Value, Size>, std::array<value_type, Size>>;
+
+        using iterator = std::conditional_t<
+            isSoa, detail::FlatmapSoaIterator<Key, Value, false>,
+            typename std::array<value_type, Size>::iterator>;
+
+        using const_iterator = std::conditional_t<
+            isSoa, detail::FlatmapSoaIterator<Key, Value, true>,
+            typename std::array<value_type, Size>::const_iterator>;
 
     private:
+        // keys in struct of arrays layout are compared with SIMD instructions, which is valid
+        // only for plain equality
+        static constexpr bool useSimdScan =
+            isSoa && detail::simd::EqualityScannable<Key>
+            && IsSameToAny<Pred, std::equal_to<>, std::equal_to<Key>>;
+
         storage_t storage{};
         std::size_t occupied{};
 
@@ -35,22 +153,22 @@ namespace isl
 
         ISL_DECL auto begin() noexcept -> iterator
         {
-            return storage.begin();
+            return iteratorAt(*this, 0);
         }
 
         ISL_DECL auto end() noexcept -> iterator
         {
-            return storage.begin() + occupied;
+            return iteratorAt(*this, occupied);
         }
 
         ISL_DECL auto begin() const noexcept -> const_iterator
         {
-            return storage.begin();
+            return iteratorAt(*this, 0);
         }
 
         ISL_DECL auto end() const noexcept -> const_iterator
         {
-            return storage.begin() + occupied;
+            return iteratorAt(*this, occupied);
         }
 
         template<typename K, typename... Ts>
@@ -61,14 +179,20 @@ namespace isl
                 throw std::out_of_range{"StaticFlatmap::tryEmplace() failed, map is full."};
             }
 
-            auto result = find(key);
+            const auto index = findIndex(key);
+
+            if (index != occupied) {
+                return {iteratorAt(*this, index), false};
+            }
 
-            if (result != end()) {
-                return {result, false};
+            if constexpr (isSoa) {
+                storage.keys[occupied] = Key(std::forward<K>(key));
+                storage.values[occupied] = Value(std::forward<Ts>(args)...);
+            } else {
+                storage[occupied] = value_type{std::forward<K>(key), std::forward<Ts>(args)...};
             }
 
-            storage[occupied++] = value_type{std::forward<K>(key), std::forward<Ts>(args)...};
-            return {result, true};
+            return {iteratorAt(*this, occupied++), true};
         }
 
         ISL_DECL auto at(const Key &key) ISL_LIFETIMEBOUND -> Value &
@@ -83,7 +207,7 @@ namespace isl
 
         ISL_DECL auto operator[](const Key &key) ISL_LIFETIMEBOUND->Value &
         {
-            return tryEmplace(key).first->second;
+            return (*tryEmplace(key).first).second;
         }
 
         ISL_DECL auto operator[](const Key &key) const ISL_LIFETIMEBOUND->const Value &
@@ -93,17 +217,17 @@ namespace isl
 
         ISL_DECL auto contains(const Key &key) const noexcept -> bool
         {
-            return find(key) != end();
+            return findIndex(key) != occupied;
         }
 
         ISL_DECL auto find(const Key &key) noexcept -> iterator
         {
-            return find(*this, key);
+            return iteratorAt(*this, findIndex(key));
         }
 
         ISL_DECL auto find(const Key &key) const noexcept -> const_iterator
         {
-            return find(*this, key);
+            return iteratorAt(*this, findIndex(key));
         }
 
         StaticFlatmap() = default;
@@ -116,31 +240,81 @@ namespace isl
                         "StaticFlatmap capacity limit reached during initialization"};
                 }
 
-                storage[occupied++] = value;
+                if constexpr (isSoa) {
+                    storage.keys[occupied] = value.first;
+                    storage.values[occupied] = value.second;
+                } else {
+                    storage[occupied] = value;
+                }
+
+                ++occupied;
             }
         }
 
     private:
+        ISL_DECL auto findIndex(const Key &key) const noexcept -> std::size_t
+        {
+            if constexpr (useSimdScan) {
+                return detail::simd::findEqual(storage.keys.data(), occupied, key);
+            } else {
+                for (std::size_t i = 0; i != occupied; ++i) {
+                    if (Pred{}(key, keyAt(i))) {
+                        return i;
+                    }
+                }
+
+                return occupied;
+            }
+        }
+
+        ISL_DECL auto keyAt(const std::size_t index) const noexcept -> const Key &
+        {
+            if constexpr (isSoa) {
+                return storage.keys[index];
+            } else {
+                return storage[index].first;
+            }
+        }
+
+        template<typename Self>
+        ISL_DECL static auto valueAt(Self &self, const std::size_t index) noexcept -> auto &
+        {
+            if constexpr (isSoa) {
+                return self.storage.values[index];
+            } else {
+                return self.storage[index].second;
+            }
+        }
+
         template<typename Self>
-        ISL_DECL static auto find(Self &self, const Key &key) noexcept -> auto
+        ISL_DECL static auto iteratorAt(Self &self, const std::size_t index) noexcept -> auto
         {
-            return std::ranges::find_if(self, [&key](const value_type &value) {
-                return Pred{}(key, value.first);
-            });
+            const auto offset = static_cast<std::ptrdiff_t>(index);
+
+            if constexpr (isSoa) {
+                using It = std::conditional_t<std::is_const_v<Self>, const_iterator, iterator>;
+                return It{self.storage.keys.data(), self.storage.values.data()} + offset;
+            } else {
+                return self.storage.begin() + offset;
+            }
         }
 
         template<typename Self>
         ISL_DECL static auto at(Self &self, const Key &key) -> auto &
         {
-            auto elem = self.find(key);
+            const auto index = self.findIndex(key);
 
-            if (elem == self.end()) {
+            if (index == self.occupied) {
                 throw std::out_of_range{"Key not found in StaticFlatmap at() method."};
             }
 
-            return elem->second;
+            return valueAt(self, index);
         }
     };
+
+    template<typename Key, typename Value, std::size_t Size, typename Pred = std::equal_to<>>
+    using StaticSoaFlatmap =
+        StaticFlatmap<Key, Value, Size, Pred, FlatmapLayout::STRUCT_OF_ARRAYS>;
 }// namespace isl
 
 #endif /* ISL_PROJECT_FLATMAP_HPP */
@@ -0,0 +1,81 @@
+#ifndef ISL_PROJECT_STRING_INTERNER_HPP
+#define ISL_PROJECT_STRING_INTERNER_HPP
+
+#include <ankerl/unordered_dense.h>
+#include <isl/string_view.hpp>
+#include <shared_mutex>
+
+namespace isl
+{
+    struct InternedString
+    {
+        SmallId id;
+        string_view str;
+
+        [[nodiscard]] auto operator==(const InternedString &other) const noexcept -> bool
+        {
+            return id == other.id;
+        }
+    };
+
+    // Thread-safe table of unique strings. Strings are copied into per-shard arenas and
+    // never move, so returned views stay valid for the lifetime of the interner, and equal
+    // strings always get the same id. A shard is chosen by the bits of the string hash which
+    // maps inside shards use neither for fingerprints nor for buckets. Every shard is guarded
+    // by its own reader-writer lock, so lookups of already interned strings only take shared
+    // locks.
+    class StringInterner
+    {
+    public:
+        static constexpr std::size_t shardBits = 6;
+        static constexpr std::size_t shardsCount = std::size_t{1} << shardBits;
+        static constexpr std::size_t maxStringsPerShard =
+            (std::size_t{1} << (32 - shardBits)) - 1;
+
+    private:
+        static constexpr std::size_t arenaBlockSize = 64 * 1024;
+
+        struct ISL_HARDWARE_CACHE_LINE_ALIGN Shard
+        {
+            mutable std::shared_mutex lock;
+            ankerl::unordered_dense::map<string_view, SmallId> ids;
+            std::vector<string_view> strings;
+            std::vector<std::unique_ptr<char[]>> arenaBlocks; // NOLINT
+            char *arenaPosition{};
+            std::size_t arenaAvailable{};
+
+            auto store(string_view str) -> string_view;
+        };
+
+        std::array<Shard, shardsCount> shards;
+
+    public:
+        StringInterner() = default;
+
+        StringInterner(const StringInterner &) = delete;
+        StringInterner(StringInterner &&) = delete;
+
+        ~StringInterner() = default;
+
+        auto operator=(const StringInterner &) -> StringInterner & = delete;
+        auto operator=(StringInterner &&) -> StringInterner & = delete;
+
+        // Returns the id and the stored copy of the string, inserting it if necessary.
+        [[nodiscard]] auto intern(string_view str) -> InternedString;
+
+        [[nodiscard]] auto find(string_view str) const -> Optional<InternedString>;
+
+        // Id must have been returned by this interner.
+        [[nodiscard]] auto getString(SmallId id) const -> string_view;
+
+        [[nodiscard]] auto size() const -> std::size_t;
+
+    private:
+        [[nodiscard]] static auto getShardIndex(string_view str) noexcept -> std::size_t;
+
+        [[nodiscard]] static auto makeId(std::size_t shard_index, std::size_t index_in_shard)
+            -> SmallId;
+    };
+} // namespace isl
+
+#endif /* ISL_PROJECT_STRING_INTERNER_HPP */
@@ -3,6 +3,8 @@
 
 #include <algorithm>
 #include <ankerl/unordered_dense.h>
+#include <cstring>
+#include <isl/detail/string_search.hpp>
 #include <isl/isl.hpp>
 #include <isl/iterator.hpp>
 #include <isl/utf8.hpp>
@@ -21,6 +23,24 @@ namespace isl
     template<CharacterLiteral CharT>
     class BasicStringView;
 
+    template<CharacterLiteral CharT, typename Delimiter>
+    class StringSplitView;
+
+    template<CharacterLiteral CharT>
+    class CodePointView;
+
+    namespace detail
+    {
+        template<CharacterLiteral CharT>
+        class SplitByCharacter;
+
+        template<CharacterLiteral CharT>
+        class SplitByLines;
+
+        template<CharacterLiteral CharT, bool SkipsEmptyTokens>
+        class SplitByAnyCharacter;
+    }// namespace detail
+
     using string_view = BasicStringView<char>;
     using u8string_view = BasicStringView<char8_t>;
     using u16string_view = BasicStringView<char16_t>;
@@ -34,6 +54,9 @@ namespace isl
         std::basic_string_view<CharT>,
         std::basic_string<CharT>>;
 
+    template<typename CharT>
+    concept Utf8Character = IsSameToAny<CharT, char, char8_t>;
+
     template<CharacterLiteral CharT>
     class BasicStringView : public AutoImplementedIteratorMethods<BasicStringView<CharT>>
     {
@@ -133,7 +156,7 @@ namespace isl
         }
 
         ISL_DECL auto withoutLastSymbol() const noexcept -> BasicStringView
-            requires(std::same_as<CharT, char> || std::same_as<CharT, char8_t>)
+            requires Utf8Character<CharT>
         {
             auto truncated = *this;
 
@@ -149,17 +172,62 @@ namespace isl
         }
 
         ISL_DECL auto withoutLastSymbol() const noexcept -> BasicStringView
-            requires(!(std::same_as<CharT, char> || std::same_as<CharT, char8_t>))
+            requires(!Utf8Character<CharT>)
         {
             return substr(0, size() - 1);
         }
 
+        // Code points of UTF-8 strings are a lead byte with all continuation bytes after it, like
+        // in withoutLastSymbol. Code points, which are not a single well-formed sequence, are
+        // read as U+FFFD.
+        ISL_DECL auto codepoints() const noexcept -> CodePointView<CharT>
+            requires Utf8Character<CharT>
+        {
+            return CodePointView<CharT>{*this};
+        }
+
+        // Returns byte offset of the code point with the given index counted from byte offset
+        // from or size if there are fewer code points. Time is linear, CodePointIndex keeps
+        // offsets for repeated random access.
+        ISL_DECL auto codePointOffset(std::size_t index, std::size_t from = 0) const noexcept
+            -> std::size_t
+            requires Utf8Character<CharT>
+        {
+            for (; index != 0 && from < length; --index) {
+                from = nextCodePoint(from);
+            }
+
+            return std::min(from, length);
+        }
+
+        // Same as substr, but first and len are counted in code points.
+        ISL_DECL auto codePointSubstr(std::size_t first, const std::size_t len = npos) const
+            noexcept -> BasicStringView
+            requires Utf8Character<CharT>
+        {
+            first = codePointOffset(first);
+
+            if (len == npos) {
+                return substr(first);
+            }
+
+            return {begin() + first, begin() + codePointOffset(len, first)};
+        }
+
         ISL_DECL auto find(CharT chr, std::size_t offset = 0) const noexcept -> std::size_t
         {
             if (offset >= length) {
                 return npos;
             }
 
+            if constexpr (isByteString) {
+                if ISL_RUNTIME_BRANCH {
+                    const auto index = detail::string_search::findByte(
+                        bytes() + offset, length - offset, static_cast<char>(chr));
+                    return index == npos ? npos : offset + index;
+                }
+            }
+
             const auto it_to_elem = std::ranges::find(begin() + offset, end(), chr);
             return it_to_elem == end() ? npos : distance(begin(), it_to_elem);
         }
@@ -170,8 +238,50 @@ namespace isl
                 return npos;
             }
 
-            const auto it_to_elem = std::ranges::find(from, end(), chr);
-            return it_to_elem == end() ? npos : distance(begin(), it_to_elem);
+            return find(chr, distance(begin(), from));
+        }
+
+        ISL_DECL auto find(const BasicStringView substring, const std::size_t offset = 0) const
+            noexcept -> std::size_t
+        {
+            if (offset > length) {
+                return npos;
+            }
+
+            if constexpr (isByteString) {
+                if ISL_RUNTIME_BRANCH {
+                    const auto index = detail::string_search::findSubstring(
+                        bytes() + offset, length - offset, substring.bytes(), substring.size());
+                    return index == npos ? npos : offset + index;
+                }
+            }
+
+            return toStd().find(substring.toStd(), offset);
+        }
+
+        // The code point is encoded once and searched as a substring. Surrogates and values
+        // above U+10FFFF are never found.
+        ISL_DECL auto findCodePoint(const char32_t chr, const std::size_t offset = 0) const
+            noexcept -> std::size_t
+            requires Utf8Character<CharT>
+        {
+            if (chr > utf8::detail::FourBytesMax || utf8::detail::isSurrogate(chr)) {
+                return npos;
+            }
+
+            if (chr <= utf8::detail::OneByteMax) {
+                return find(as<CharT>(chr), offset);
+            }
+
+            auto encoded = std::array<char, 4>{};
+            auto needle = std::array<CharT, 4>{};
+            const auto encoded_size = utf8::detail::encodeCodePoint(chr, encoded.data());
+
+            std::ranges::transform(encoded, needle.begin(), [](char byte) {
+                return as<CharT>(byte);
+            });
+
+            return find(BasicStringView{needle.data(), encoded_size}, offset);
         }
 
         ISL_DECL auto contains(CharT chr) const noexcept -> bool
@@ -179,8 +289,39 @@ namespace isl
             return find(chr) != npos;
         }
 
+        ISL_DECL auto containsCodePoint(const char32_t chr) const noexcept -> bool
+            requires Utf8Character<CharT>
+        {
+            return findCodePoint(chr) != npos;
+        }
+
+        ISL_DECL auto contains(const BasicStringView substring) const noexcept -> bool
+        {
+            return find(substring) != npos;
+        }
+
+        ISL_DECL auto findFirstOf(const BasicStringView characters, const std::size_t offset = 0)
+            const noexcept -> std::size_t
+        {
+            return findFirstOf<true>(characters, offset);
+        }
+
+        ISL_DECL auto findFirstNotOf(const BasicStringView characters, const std::size_t offset = 0)
+            const noexcept -> std::size_t
+        {
+            return findFirstOf<false>(characters, offset);
+        }
+
         ISL_DECL auto findRangeEnd(CharT range_start, CharT range_end) const noexcept -> std::size_t
         {
+            if constexpr (isByteString) {
+                if ISL_RUNTIME_BRANCH {
+                    return detail::string_search::findRangeEnd(
+                        bytes(), length, static_cast<char>(range_start),
+                        static_cast<char>(range_end));
+                }
+            }
+
             auto pairs_count = std::size_t{};
 
             const auto matched_pair_iterator =
@@ -197,12 +338,64 @@ namespace isl
             return distance(begin(), matched_pair_iterator);
         }
 
+        // Same as findRangeEnd, but range characters inside quotes are skipped. Escape character
+        // makes the next character ordinary, so escaped quotes do not end strings.
+        ISL_DECL auto findQuotedRangeEnd(
+            CharT range_start, CharT range_end, CharT quote, CharT escape) const noexcept
+            -> std::size_t
+        {
+            if constexpr (isByteString) {
+                if ISL_RUNTIME_BRANCH {
+                    return detail::string_search::findQuotedRangeEnd(
+                        bytes(), length,
+                        {
+                            .open = static_cast<char>(range_start),
+                            .close = static_cast<char>(range_end),
+                            .quote = static_cast<char>(quote),
+                            .escape = static_cast<char>(escape),
+                        });
+                }
+            }
+
+            auto pairs_count = std::size_t{};
+            auto in_string = false;
+            auto escaped = false;
+
+            for (std::size_t i = 0; i != length; ++i) {
+                const auto chr = string[i];
+
+                if (escaped) {
+                    escaped = false;
+                } else if (chr == escape) {
+                    escaped = true;
+                } else if (chr == quote) {
+                    in_string = !in_string;
+                } else if (!in_string) {
+                    pairs_count += static_cast<std::size_t>(chr == range_start);
+                    pairs_count -= static_cast<std::size_t>(chr == range_end);
+                }
+
+                if (pairs_count == 0) {
+                    return i;
+                }
+            }
+
+            return npos;
+        }
+
         ISL_DECL auto rfind(CharT chr, const std::size_t offset = 0) const noexcept -> std::size_t
         {
             if (offset >= length) {
                 return npos;
             }
 
+            if constexpr (isByteString) {
+                if ISL_RUNTIME_BRANCH {
+                    return detail::string_search::findLastByte(
+                        bytes(), length - offset, static_cast<char>(chr));
+                }
+            }
+
             const auto reverse_end = this->rend();
 
             const auto it_to_elem = std::ranges::find(
@@ -213,6 +406,14 @@ namespace isl
 
         ISL_DECL auto lstrip(BasicStringView characters_to_strip) const -> BasicStringView
         {
+            if constexpr (isByteString) {
+                if ISL_RUNTIME_BRANCH {
+                    const auto first = detail::string_search::findFirstNotOf(
+                        bytes(), length, characters_to_strip.toByteSet());
+                    return first == npos ? BasicStringView{end(), end()} : substr(first);
+                }
+            }
+
             auto stripped_string = *this;
             auto has_characters_to_strip = [&stripped_string, &characters_to_strip]() {
                 const auto first_character = stripped_string.front();
@@ -229,6 +430,14 @@ namespace isl
 
         ISL_DECL auto rstrip(const BasicStringView characters_to_strip) const -> BasicStringView
         {
+            if constexpr (isByteString) {
+                if ISL_RUNTIME_BRANCH {
+                    const auto last = detail::string_search::findLastNotOf(
+                        bytes(), length, characters_to_strip.toByteSet());
+                    return last == npos ? BasicStringView{begin(), begin()} : substr(0, last + 1);
+                }
+            }
+
             auto stripped_string = *this;
 
             while (!stripped_string.empty() &&
@@ -241,10 +450,53 @@ namespace isl
 
         ISL_DECL auto strip(BasicStringView characters_to_strip) const -> BasicStringView
         {
+            if constexpr (isByteString) {
+                if ISL_RUNTIME_BRANCH {
+                    // the set is built once for both ends
+                    const auto set = characters_to_strip.toByteSet();
+                    const auto first = detail::string_search::findFirstNotOf(bytes(), length, set);
+
+                    if (first == npos) {
+                        return {end(), end()};
+                    }
+
+                    const auto last =
+                        detail::string_search::findLastNotOf(bytes() + first, length - first, set);
+                    return substr(first, last + 1);
+                }
+            }
+
             const auto left_stripped = lstrip(characters_to_strip);
             return left_stripped.rstrip(characters_to_strip);
         }
 
+        // Lazy views over parts of the string, no parts are copied. Like std::views::split,
+        // splitBy and splitByAny keep empty parts and yield nothing for an empty string.
+        ISL_DECL auto splitBy(CharT separator) const noexcept
+            -> StringSplitView<CharT, detail::SplitByCharacter<CharT>>
+        {
+            return {*this, detail::SplitByCharacter<CharT>{separator}};
+        }
+
+        ISL_DECL auto splitByAny(BasicStringView separators) const noexcept
+            -> StringSplitView<CharT, detail::SplitByAnyCharacter<CharT, false>>
+        {
+            return {*this, detail::SplitByAnyCharacter<CharT, false>{separators}};
+        }
+
+        // Lines end with '\n' or "\r\n", the last line may have no line ending.
+        ISL_DECL auto lines() const noexcept -> StringSplitView<CharT, detail::SplitByLines<CharT>>
+        {
+            return {*this, detail::SplitByLines<CharT>{}};
+        }
+
+        // Words separated by runs of whitespace characters, there are no empty words.
+        ISL_DECL auto splitWhitespace() const noexcept
+            -> StringSplitView<CharT, detail::SplitByAnyCharacter<CharT, true>>
+        {
+            return {*this, detail::SplitByAnyCharacter<CharT, true>::whitespace()};
+        }
+
         ISL_DECL auto setLength(std::size_t new_length) const noexcept -> BasicStringView
         {
             auto new_string = *this;
@@ -299,38 +551,129 @@ namespace isl
 
         ISL_DECL auto operator==(const BasicStringView &other) const noexcept -> bool
         {
-            return this->operator==(static_cast<std::string_view>(other));
+            if (size() != other.size()) {
+                return false;
+            }
+
+            if ISL_RUNTIME_BRANCH {
+                return empty() || std::memcmp(string, other.string, size() * sizeof(CharT)) == 0;
+            }
+
+            return std::equal(begin(), end(), other.begin());
         }
 
         ISL_DECL auto operator==(const StringLike<CharT> auto &other) const noexcept -> bool
         {
-            return std::equal(begin(), end(), std::begin(other), std::end(other));
+            return *this == BasicStringView{std::data(other), std::size(other)};
         }
 
         ISL_DECL auto operator<=>(const BasicStringView &other) const noexcept
             -> std::strong_ordering
         {
-            return this->operator<=>(as<std::string_view>(other));
+            const auto common_size = std::min(size(), other.size());
+            const auto mismatch = findMismatch(other, common_size);
+
+            if (mismatch != common_size) {
+                return string[mismatch] <=> other.string[mismatch];
+            }
+
+            return size() <=> other.size();
         }
 
         ISL_DECL auto operator<=>(const StringLike<CharT> auto &other) const noexcept
             -> std::strong_ordering
         {
-            auto min_size = std::min(size(), std::size(other));
+            return *this <=> BasicStringView{std::data(other), std::size(other)};
+        }
 
-            for (auto i = std::size_t{}; i != min_size; ++i) {
-                const auto left_chr = at(i);
-                const auto right_chr = other.at(i);
+    private:
+        // single byte strings are searched with vectorized kernels at runtime
+        static constexpr bool isByteString = sizeof(CharT) == 1;
 
-                if (auto cmp = left_chr <=> right_chr; cmp != 0) {
-                    return cmp;
+        template<bool InSet>
+        ISL_DECL auto findFirstOf(const BasicStringView characters, const std::size_t offset) const
+            noexcept -> std::size_t
+        {
+            if (offset >= length) {
+                return npos;
+            }
+
+            if constexpr (isByteString) {
+                if ISL_RUNTIME_BRANCH {
+                    const auto set = characters.toByteSet();
+                    const auto index =
+                        InSet ? detail::string_search::findFirstOf(
+                                    bytes() + offset, length - offset, set)
+                              : detail::string_search::findFirstNotOf(
+                                    bytes() + offset, length - offset, set);
+                    return index == npos ? npos : offset + index;
+                }
+            }
+
+            // std::basic_string_view compares pointers into the set with null, GCC with
+            // sanitizers rejects such comparisons in constant expressions
+            for (std::size_t index = offset; index != length; ++index) {
+                if (characters.contains(string[index]) == InSet) {
+                    return index;
                 }
             }
 
-            return size() <=> std::size(other);
+            return npos;
+        }
+
+        // Returns index of the first character that differs in the first count characters of
+        // both strings or count if they are equal.
+        ISL_DECL auto findMismatch(const BasicStringView &other, const std::size_t count) const
+            noexcept -> std::size_t
+        {
+            // random strings usually differ in the first character, it is checked before the
+            // call to the vectorized kernel
+            if (count == 0 || string[0] != other.string[0]) {
+                return 0;
+            }
+
+            if ISL_RUNTIME_BRANCH {
+                const auto index = detail::string_search::findMismatch(
+                    bytes(), other.bytes(), count * sizeof(CharT));
+                return index == npos ? count : index / sizeof(CharT);
+            }
+
+            for (std::size_t i = 1; i != count; ++i) {
+                if (string[i] != other.string[i]) {
+                    return i;
+                }
+            }
+
+            return count;
+        }
+
+        // Returns offset of the next lead byte after offset or size.
+        ISL_DECL auto nextCodePoint(std::size_t offset) const noexcept -> std::size_t
+        {
+            ++offset;
+
+            while (offset < length && utf8::isTrailingCharacter(as<char>(string[offset]))) {
+                ++offset;
+            }
+
+            return offset;
+        }
+
+        ISL_DECL auto toStd() const noexcept -> std::basic_string_view<CharT>
+        {
+            return {string, length};
+        }
+
+        [[nodiscard]] auto bytes() const noexcept -> const char *
+        {
+            return reinterpret_cast<const char *>(string);// NOLINT
+        }
+
+        ISL_DECL auto toByteSet() const noexcept -> detail::string_search::ByteSet
+        {
+            return {string, length};
         }
 
-    private:
         template<typename T>
         ISL_DECL static auto distance(T first, T last) noexcept -> std::size_t
         {
@@ -338,6 +681,436 @@ namespace isl
         }
     };
 
+    namespace detail
+    {
+        template<CharacterLiteral CharT>
+        class SplitByCharacter
+        {
+        private:
+            CharT separator;
+
+        public:
+            static constexpr bool skipsEmptyTokens = false;
+            static constexpr bool dropsTrailingEmptyToken = false;
+
+            constexpr explicit SplitByCharacter(const CharT chr) noexcept
+              : separator{chr}
+            {}
+
+            // Separators of 64 characters after base are kept in a mask, so short tokens are
+            // found without a call to the vectorized search for each of them.
+            struct Cursor
+            {
+                std::size_t base{BasicStringView<CharT>::npos};
+                u64 mask{};
+            };
+
+            ISL_DECL auto findSeparator(
+                const BasicStringView<CharT> &str, std::size_t from, Cursor &cursor) const noexcept
+                -> std::size_t
+            {
+                if constexpr (sizeof(CharT) == 1) {
+                    if ISL_RUNTIME_BRANCH {
+                        const auto *bytes = reinterpret_cast<const char *>(str.data());// NOLINT
+
+                        while (from < str.size()) {
+                            if (from < cursor.base || from - cursor.base >= 64) {
+                                cursor.base = from;
+                                cursor.mask = string_search::equalMask64(
+                                    bytes + from, str.size() - from, static_cast<char>(separator));
+
+                                // long tokens are searched by the vectorized search
+                                if (cursor.mask == 0) {
+                                    cursor.base = BasicStringView<CharT>::npos;
+                                    return str.find(separator, from + 64);
+                                }
+                            }
+
+                            const auto shift = from - cursor.base;
+
+                            if (const auto mask = cursor.mask >> shift; mask != 0) {
+                                return from + static_cast<std::size_t>(std::countr_zero(mask));
+                            }
+
+                            from = cursor.base + 64;
+                        }
+
+                        return BasicStringView<CharT>::npos;
+                    }
+                }
+
+                return str.find(separator, from);
+            }
+
+            ISL_DECL static auto trim(const BasicStringView<CharT> token) noexcept
+                -> BasicStringView<CharT>
+            {
+                return token;
+            }
+        };
+
+        template<CharacterLiteral CharT>
+        class SplitByLines
+        {
+        public:
+            static constexpr bool skipsEmptyTokens = false;
+            // line ending of the last line does not start another line
+            static constexpr bool dropsTrailingEmptyToken = true;
+
+            using Cursor = typename SplitByCharacter<CharT>::Cursor;
+
+            ISL_DECL static auto findSeparator(
+                const BasicStringView<CharT> &str, const std::size_t from, Cursor &cursor) noexcept
+                -> std::size_t
+            {
+                constexpr auto line_feed = SplitByCharacter<CharT>{static_cast<CharT>('\n')};
+                return line_feed.findSeparator(str, from, cursor);
+            }
+
+            ISL_DECL static auto trim(const BasicStringView<CharT> token) noexcept
+                -> BasicStringView<CharT>
+            {
+                const auto last = token.size() - 1;
+
+                if (!token.empty() && token.data()[last] == static_cast<CharT>('\r')) {
+                    return token.substr(0, last);
+                }
+
+                return token;
+            }
+        };
+
+        template<CharacterLiteral CharT>
+        inline constexpr std::array<CharT, 6> WhitespaceCharacters{
+            static_cast<CharT>(' '),  static_cast<CharT>('\t'), static_cast<CharT>('\n'),
+            static_cast<CharT>('\v'), static_cast<CharT>('\f'), static_cast<CharT>('\r'),
+        };
+
+        template<CharacterLiteral CharT, bool SkipsEmptyTokens>
+        class SplitByAnyCharacter
+        {
+        private:
+            // single byte strings are searched with a set built once for the whole view
+            static constexpr bool isByteString = sizeof(CharT) == 1;
+
+            BasicStringView<CharT> separators;
+            string_search::ByteSet separatorsSet;
+
+        public:
+            static constexpr bool skipsEmptyTokens = SkipsEmptyTokens;
+            static constexpr bool dropsTrailingEmptyToken = false;
+
+            constexpr explicit SplitByAnyCharacter(
+                const BasicStringView<CharT> separator_characters) noexcept
+              : separators{separator_characters}
+            {
+                if constexpr (isByteString) {
+                    separatorsSet = {separators.data(), separators.size()};
+                }
+            }
+
+            ISL_DECL static auto whitespace() noexcept -> SplitByAnyCharacter
+            {
+                return SplitByAnyCharacter{BasicStringView<CharT>{WhitespaceCharacters<CharT>}};
+            }
+
+            struct Cursor
+            {};
+
+            ISL_DECL auto findSeparator(
+                const BasicStringView<CharT> &str, const std::size_t from,
+                [[maybe_unused]] Cursor &cursor) const noexcept -> std::size_t
+            {
+                return find<true>(str, from);
+            }
+
+            ISL_DECL auto findToken(const BasicStringView<CharT> &str, const std::size_t from)
+                const noexcept -> std::size_t
+            {
+                return find<false>(str, from);
+            }
+
+            ISL_DECL static auto trim(const BasicStringView<CharT> token) noexcept
+                -> BasicStringView<CharT>
+            {
+                return token;
+            }
+
+        private:
+            template<bool IsSeparator>
+            ISL_DECL auto find(const BasicStringView<CharT> &str, const std::size_t from)
+                const noexcept -> std::size_t
+            {
+                if constexpr (isByteString) {
+                    if ISL_RUNTIME_BRANCH {
+                        const auto *bytes = reinterpret_cast<const char *>(str.data());// NOLINT
+                        const auto *first = bytes + from;
+                        const auto size = str.size() - from;
+
+                        const auto index =
+                            IsSeparator ? string_search::findFirstOf(first, size, separatorsSet)
+                                        : string_search::findFirstNotOf(first, size, separatorsSet);
+
+                        return index == string_search::npos ? BasicStringView<CharT>::npos
+                                                            : from + index;
+                    }
+                }
+
+                if constexpr (IsSeparator) {
+                    return str.findFirstOf(separators, from);
+                } else {
+                    return str.findFirstNotOf(separators, from);
+                }
+            }
+        };
+    }// namespace detail
+
+    // Forward range of string parts between separators found by Delimiter.
+    template<CharacterLiteral CharT, typename Delimiter>
+    class StringSplitView : public std::ranges::view_interface<StringSplitView<CharT, Delimiter>>
+    {
+    private:
+        static constexpr auto npos = BasicStringView<CharT>::npos;
+
+        BasicStringView<CharT> string;
+        Delimiter delimiter;
+
+    public:
+        class iterator
+        {
+        private:
+            const StringSplitView *parent{};
+            std::size_t tokenBegin{npos};
+            std::size_t tokenEnd{};
+            ISL_NO_UNIQUE_ADDRESS typename Delimiter::Cursor cursor{};
+
+        public:
+            using value_type = BasicStringView<CharT>;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::forward_iterator_tag;
+
+            iterator() = default;
+
+            constexpr iterator(const StringSplitView &view, const std::size_t from) noexcept
+              : parent{&view}
+            {
+                findToken(from);
+            }
+
+            ISL_DECL auto operator*() const noexcept -> value_type
+            {
+                return parent->delimiter.trim(
+                    parent->string.substr(tokenBegin, tokenEnd - tokenBegin));
+            }
+
+            constexpr auto operator++() noexcept -> iterator &
+            {
+                if (tokenEnd == parent->string.size()) {
+                    tokenBegin = npos;
+                } else {
+                    findToken(tokenEnd + 1);
+                }
+
+                return *this;
+            }
+
+            constexpr auto operator++(int) noexcept -> iterator
+            {
+                auto old = *this;
+                ++*this;
+                return old;
+            }
+
+            ISL_DECL auto operator==(const iterator &other) const noexcept -> bool
+            {
+                return tokenBegin == other.tokenBegin;
+            }
+
+            ISL_DECL auto operator==([[maybe_unused]] std::default_sentinel_t _) const noexcept
+                -> bool
+            {
+                return tokenBegin == npos;
+            }
+
+        private:
+            constexpr auto findToken(std::size_t from) noexcept -> void
+            {
+                const auto &str = parent->string;
+
+                if constexpr (Delimiter::skipsEmptyTokens) {
+                    from = parent->delimiter.findToken(str, from);
+
+                    if (from == npos) {
+                        tokenBegin = npos;
+                        return;
+                    }
+                } else {
+                    const auto is_last_token = from == str.size();
+
+                    if (is_last_token && (from == 0 || Delimiter::dropsTrailingEmptyToken)) {
+                        tokenBegin = npos;
+                        return;
+                    }
+                }
+
+                const auto separator = parent->delimiter.findSeparator(str, from, cursor);
+
+                tokenBegin = from;
+                tokenEnd = separator == npos ? str.size() : separator;
+            }
+        };
+
+        constexpr StringSplitView(
+            const BasicStringView<CharT> str, const Delimiter &split_delimiter) noexcept
+          : string{str}
+          , delimiter{split_delimiter}
+        {}
+
+        ISL_DECL auto begin() const noexcept -> iterator
+        {
+            return {*this, 0};
+        }
+
+        ISL_DECL static auto end() noexcept -> std::default_sentinel_t
+        {
+            return std::default_sentinel;
+        }
+    };
+
+    // Bidirectional range of code points of a UTF-8 string.
+    template<CharacterLiteral CharT>
+    class CodePointView : public std::ranges::view_interface<CodePointView<CharT>>
+    {
+    private:
+        BasicStringView<CharT> string;
+
+    public:
+        static constexpr char32_t replacementCharacter = 0xFFFD;
+
+        class iterator
+        {
+        private:
+            const CharT *first{};
+            const CharT *last{};
+            const CharT *current{};
+            const CharT *next{};
+
+        public:
+            using value_type = char32_t;
+            using difference_type = std::ptrdiff_t;
+            using iterator_concept = std::bidirectional_iterator_tag;
+
+            iterator() = default;
+
+            constexpr iterator(const BasicStringView<CharT> &str, const CharT *position) noexcept
+              : first{str.begin()}
+              , last{str.end()}
+              , current{position}
+              , next{findNext(position)}
+            {}
+
+            // Returns pointer to the first byte of the code point.
+            ISL_DECL auto base() const noexcept -> const CharT *
+            {
+                return current;
+            }
+
+            ISL_DECL auto operator*() const noexcept -> char32_t
+            {
+                const auto lead = as<u8>(*current);
+                const auto units_count = as<std::size_t>(next - current);
+
+                if (lead <= utf8::detail::OneByteMax && units_count == 1) [[likely]] {
+                    return lead;
+                }
+
+                if (units_count > 4) {
+                    return replacementCharacter;
+                }
+
+                auto bytes = std::array<char, 4>{};
+
+                for (std::size_t i = 0; i != units_count; ++i) {
+                    bytes[i] = as<char>(current[i]);
+                }
+
+                const auto sequence_size =
+                    utf8::detail::validSequenceSize(bytes.data(), units_count);
+
+                if (sequence_size != units_count) {
+                    return replacementCharacter;
+                }
+
+                return utf8::detail::decodeCodePoint(bytes.data(), sequence_size);
+            }
+
+            constexpr auto operator++() noexcept -> iterator &
+            {
+                current = next;
+                next = findNext(next);
+                return *this;
+            }
+
+            constexpr auto operator++(int) noexcept -> iterator
+            {
+                auto old = *this;
+                ++*this;
+                return old;
+            }
+
+            constexpr auto operator--() noexcept -> iterator &
+            {
+                next = current;
+
+                do {
+                    --current;
+                } while (current != first && utf8::isTrailingCharacter(as<char>(*current)));
+
+                return *this;
+            }
+
+            constexpr auto operator--(int) noexcept -> iterator
+            {
+                auto old = *this;
+                --*this;
+                return old;
+            }
+
+            ISL_DECL auto operator==(const iterator &other) const noexcept -> bool
+            {
+                return current == other.current;
+            }
+
+        private:
+            ISL_DECL auto findNext(const CharT *position) const noexcept -> const CharT *
+            {
+                if (position == last) {
+                    return last;
+                }
+
+                do {
+                    ++position;
+                } while (position != last && utf8::isTrailingCharacter(as<char>(*position)));
+
+                return position;
+            }
+        };
+
+        constexpr explicit CodePointView(const BasicStringView<CharT> str) noexcept
+          : string{str}
+        {}
+
+        ISL_DECL auto begin() const noexcept -> iterator
+        {
+            return {string, string.begin()};
+        }
+
+        ISL_DECL auto end() const noexcept -> iterator
+        {
+            return {string, string.end()};
+        }
+    };
+
     namespace string_view_literals
     {
         [[nodiscard]] consteval auto operator""_sv(const char *string, std::size_t length)
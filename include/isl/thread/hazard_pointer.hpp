@@ -0,0 +1,103 @@
+#ifndef ISL_PROJECT_HAZARD_POINTER_HPP
+#define ISL_PROJECT_HAZARD_POINTER_HPP
+
+#include <array>
+#include <atomic>
+#include <isl/isl.hpp>
+
+namespace isl::thread
+{
+    // Each thread owns a record on its own cache line, so publishing a hazard never
+    // touches memory shared with other readers. Records are never freed, only reused.
+    struct ISL_HARDWARE_CACHE_LINE_ALIGN HazardRecord
+    {
+        static constexpr std::size_t slotsCount = 4;
+
+        std::array<std::atomic<const void *>, slotsCount> slots{};
+        std::atomic<bool> active{false};
+        u8 usedSlots{};
+        HazardRecord *next{};
+    };
+
+    namespace detail
+    {
+        [[nodiscard]] auto localHazardRecord() -> HazardRecord &;
+
+        [[nodiscard]] auto acquireHazardRecord() -> HazardRecord *;
+
+        auto releaseHazardRecord(HazardRecord *record) noexcept -> void;
+    } // namespace detail
+
+    [[nodiscard]] auto isHazardous(const void *pointer) noexcept -> bool;
+
+    class HazardGuard
+    {
+    private:
+        std::atomic<const void *> *slot{};
+        HazardRecord *record{};
+        HazardRecord *temporaryRecord{};
+        u8 slotIndex{};
+
+    public:
+        HazardGuard()
+          : record{std::addressof(detail::localHazardRecord())}
+        {
+            for (u8 i = 0; i != HazardRecord::slotsCount; ++i) {
+                if ((record->usedSlots & (1U << i)) == 0) {
+                    record->usedSlots = static_cast<u8>(record->usedSlots | (1U << i));
+                    slotIndex = i;
+                    slot = std::addressof(record->slots[i]);
+                    return;
+                }
+            }
+
+            // all local slots are busy, borrow a whole record for this guard
+            temporaryRecord = detail::acquireHazardRecord();
+            slot = std::addressof(temporaryRecord->slots[0]);
+        }
+
+        HazardGuard(const HazardGuard &) = delete;
+        HazardGuard(HazardGuard &&) = delete;
+
+        ~HazardGuard()
+        {
+            slot->store(nullptr, std::memory_order_release);
+
+            if (temporaryRecord != nullptr) {
+                detail::releaseHazardRecord(temporaryRecord);
+                return;
+            }
+
+            record->usedSlots = static_cast<u8>(record->usedSlots & ~(1U << slotIndex));
+        }
+
+        auto operator=(const HazardGuard &) -> HazardGuard & = delete;
+        auto operator=(HazardGuard &&) -> HazardGuard & = delete;
+
+        // Publishes the current value of source and returns it once it is known that the
+        // value was not replaced before the hazard became visible to reclaimers.
+        template <typename T>
+        auto protect(const std::atomic<T *> &source) noexcept -> T *
+        {
+            auto *pointer = source.load(std::memory_order_relaxed);
+
+            while (true) {
+                slot->store(pointer, std::memory_order_seq_cst);
+                auto *reloaded = source.load(std::memory_order_seq_cst);
+
+                if (reloaded == pointer) {
+                    return pointer;
+                }
+
+                pointer = reloaded;
+            }
+        }
+
+        auto reset() noexcept -> void
+        {
+            slot->store(nullptr, std::memory_order_release);
+        }
+    };
+} // namespace isl::thread
+
+#endif /* ISL_PROJECT_HAZARD_POINTER_HPP */
@@ -16,213 +16,258 @@ namespace isl
 
     namespace detail
     {
-        struct PointerAndDeleter
+        // Shared by all UniqueAny's storing the same type the same way, so each instance
+        // keeps a single pointer to it instead of a type_index and a flag.
+        struct UniqueAnyTypeDescriptor
         {
-            void *pointer = nullptr;
-            void (*deleter)(void *) = nullptr;
+            const std::type_info *typeInfo;
+            void (*destroy)(void *storage) noexcept;
+            // moves object from source to destination and destroys the source, nullptr when
+            // the storage can be copied byte by byte
+            void (*relocate)(void *destination, void *source) noexcept;
+            bool storedInline;
+        };
+
+        template <typename T, std::size_t BufferSize>
+        concept UniqueAnyCanStoreInside = sizeof(T) <= BufferSize
+                                          && alignof(T) <= alignof(void *)
+                                          && std::is_nothrow_move_constructible_v<T>;
+
+        template <typename T>
+        constexpr inline UniqueAnyTypeDescriptor InlineUniqueAnyDescriptor{
+            .typeInfo = &typeid(T),
+            .destroy = [](void *storage) noexcept { std::destroy_at(static_cast<T *>(storage)); },
+            .relocate = std::is_trivially_copyable_v<T>
+                            ? nullptr
+                            : +[](void *destination, void *source) noexcept {
+                                  auto *object = static_cast<T *>(source);
+                                  std::construct_at(
+                                      static_cast<T *>(destination), std::move(*object));
+                                  std::destroy_at(object);
+                              },
+            .storedInline = true,
         };
 
         template <typename T>
-        concept UniqueAnyCanStoreInside =
-            std::is_trivial_v<T> && sizeof(T) <= sizeof(PointerAndDeleter);
+        constexpr inline UniqueAnyTypeDescriptor HeapUniqueAnyDescriptor{
+            .typeInfo = &typeid(T),
+            .destroy = [](void *storage) noexcept { delete *static_cast<T **>(storage); },
+            .relocate = nullptr,
+            .storedInline = false,
+        };
     } // namespace detail
 
-    class UniqueAny
+    // Objects which are nothrow move constructible, fit into BufferSize bytes and need no
+    // more than pointer alignment are stored inline, everything else is allocated on the heap.
+    template <std::size_t BufferSize>
+    requires(BufferSize >= sizeof(void *))
+    class BasicUniqueAny
     {
-        union {
-            detail::PointerAndDeleter pointerAndDeleter{};
-            std::array<std::byte, sizeof(detail::PointerAndDeleter)> rowBuffer;
-        };
+        template <typename T>
+        static constexpr bool canStoreInline = detail::UniqueAnyCanStoreInside<T, BufferSize>;
 
-        std::type_index typeIndex{typeid(std::nullopt_t)};
-        bool storesTrivialObject{};
+        alignas(void *) std::array<std::byte, BufferSize> storage{};
+        const detail::UniqueAnyTypeDescriptor *descriptor{};
 
     public:
-        UniqueAny() = default;
+        BasicUniqueAny() = default;
 
         // NOLINTNEXTLINE
-        UniqueAny(std::nullopt_t)
-          : storesTrivialObject{true}
+        BasicUniqueAny(std::nullopt_t)
         {}
 
         template <typename T>
-        explicit UniqueAny(std::unique_ptr<T> ptr)
-          : typeIndex{typeid(T)}
+        explicit BasicUniqueAny(std::unique_ptr<T> ptr)
+          : descriptor{std::addressof(detail::HeapUniqueAnyDescriptor<T>)}
         {
-            pointerAndDeleter.pointer = ptr.release();
-            pointerAndDeleter.deleter = [](void *p) { delete static_cast<T *>(p); };
+            getHeapPointer() = ptr.release();
         }
 
         template <typename T>
-        [[nodiscard]] explicit UniqueAny(T &&object)
+        requires(!std::same_as<std::remove_cvref_t<T>, BasicUniqueAny>)
+        [[nodiscard]] explicit BasicUniqueAny(T &&object)
         {
-            emplace<T>(std::forward<T>(object));
+            emplace<std::remove_cvref_t<T>>(std::forward<T>(object));
         }
 
         template <typename T, typename... Ts>
         requires(std::constructible_from<T, Ts...>)
-        [[nodiscard]] explicit UniqueAny(std::in_place_type_t<T> /*unused*/, Ts &&...args)
+        [[nodiscard]] explicit BasicUniqueAny(std::in_place_type_t<T> /*unused*/, Ts &&...args)
         {
             emplace<T>(std::forward<Ts>(args)...);
         }
 
-        UniqueAny(const UniqueAny &) = delete;
+        BasicUniqueAny(const BasicUniqueAny &) = delete;
 
-        UniqueAny(UniqueAny &&other) noexcept
-          : rowBuffer{other.rowBuffer}
-          , typeIndex{other.typeIndex}
-          , storesTrivialObject{other.storesTrivialObject}
+        BasicUniqueAny(BasicUniqueAny &&other) noexcept
         {
-            other.pointerAndDeleter.pointer = nullptr;
-            other.pointerAndDeleter.deleter = nullptr;
-            other.clearTypeInfo();
+            moveFrom(other);
         }
 
-        ~UniqueAny()
+        ~BasicUniqueAny()
         {
             deleteStoredObject();
         }
 
-        auto operator=(const UniqueAny &) -> void = delete;
+        auto operator=(const BasicUniqueAny &) -> void = delete;
 
-        auto operator=(UniqueAny &&other) noexcept -> UniqueAny &
+        auto operator=(BasicUniqueAny &&other) noexcept -> BasicUniqueAny &
         {
-            std::swap(rowBuffer, other.rowBuffer);
-            std::swap(typeIndex, other.typeIndex);
-            std::swap(storesTrivialObject, other.storesTrivialObject);
+            if (this != &other) {
+                deleteStoredObject();
+                moveFrom(other);
+            }
 
             return *this;
         }
 
+        ISL_DECL static auto getBufferSize() noexcept -> std::size_t
+        {
+            return BufferSize;
+        }
+
         [[nodiscard]] auto hasValue() const noexcept -> bool
         {
-            return typeIndex != std::type_index(typeid(std::nullopt_t));
+            return descriptor != nullptr;
         }
 
-        [[nodiscard]] auto getTypeIndex() const noexcept -> std::type_index
+        [[nodiscard]] auto storesInline() const noexcept -> bool
         {
-            return typeIndex;
+            return descriptor != nullptr && descriptor->storedInline;
         }
 
-        template <detail::UniqueAnyCanStoreInside T, typename... Ts>
-        requires(std::constructible_from<T, Ts...>)
-        auto emplace(Ts &&...args) -> void
+        [[nodiscard]] auto getTypeIndex() const noexcept -> std::type_index
         {
-            deleteStoredObject();
-            typeIndex = std::type_index{typeid(T)};
+            if (descriptor == nullptr) {
+                return std::type_index{typeid(std::nullopt_t)};
+            }
 
-            storesTrivialObject = true;
-            std::construct_at(reinterpret_cast<T *>(rowBuffer.data()), std::forward<Ts>(args)...);
+            return std::type_index{*descriptor->typeInfo};
         }
 
         template <typename T, typename... Ts>
         auto emplace(Ts &&...args) -> void requires(std::constructible_from<T, Ts...>)
         {
             deleteStoredObject();
-            typeIndex = std::type_index{typeid(T)};
-
-            storesTrivialObject = false;
-            pointerAndDeleter.pointer = static_cast<void *>(new T{std::forward<Ts>(args)...});
-            pointerAndDeleter.deleter = [](void *p) { delete static_cast<T *>(p); };
-        }
-
-        template <detail::UniqueAnyCanStoreInside T>
-        [[nodiscard]] auto get() -> T
-        {
-            checkTypeMatch<T>();
 
-            auto result = T{*reinterpret_cast<T *>(rowBuffer.data())};
-            clearInternalStorage();
-
-            return result;
+            if constexpr (canStoreInline<T>) {
+                std::construct_at(
+                    static_cast<T *>(static_cast<void *>(storage.data())),
+                    std::forward<Ts>(args)...);
+                descriptor = std::addressof(detail::InlineUniqueAnyDescriptor<T>);
+            } else {
+                getHeapPointer() = static_cast<void *>(new T{std::forward<Ts>(args)...});
+                descriptor = std::addressof(detail::HeapUniqueAnyDescriptor<T>);
+            }
         }
 
         template <typename T>
         [[nodiscard]] auto get() -> T
         {
-            checkTypeMatch<T>();
-
-            T result = std::move(*static_cast<T *>(pointerAndDeleter.pointer));
+            T result = std::move(*observe<T>());
             clearInternalStorage();
 
             return result;
         }
 
-        template <detail::UniqueAnyCanStoreInside T>
-        [[nodiscard]] auto observe() -> T *
-        {
-            checkTypeMatch<T>();
-            return reinterpret_cast<T *>(rowBuffer.data());
-        }
-
         template <typename T>
         [[nodiscard]] auto observe() -> T *
         {
             checkTypeMatch<T>();
-            return static_cast<T *>(pointerAndDeleter.pointer);
+
+            if (descriptor->storedInline) {
+                return static_cast<T *>(static_cast<void *>(storage.data()));
+            }
+
+            return static_cast<T *>(getHeapPointer());
         }
 
+        // Heap objects are handed over, inline objects are moved into a new allocation.
         template <typename T>
-        requires(!detail::UniqueAnyCanStoreInside<T>)
         [[nodiscard]] auto release() -> std::unique_ptr<T>
         {
             checkTypeMatch<T>();
 
-            auto *ptr = static_cast<T *>(std::exchange(pointerAndDeleter.pointer, nullptr));
-            pointerAndDeleter.deleter = nullptr;
-            clearTypeInfo();
+            if constexpr (canStoreInline<T>) {
+                if (descriptor->storedInline) {
+                    auto result = std::make_unique<T>(std::move(*observe<T>()));
+                    clearInternalStorage();
+
+                    return result;
+                }
+            }
+
+            auto *ptr = static_cast<T *>(std::exchange(getHeapPointer(), nullptr));
+            descriptor = nullptr;
 
             return std::unique_ptr<T>{ptr};
         }
 
     private:
-        auto deleteStoredObject() const -> void
+        [[nodiscard]] auto getHeapPointer() noexcept -> void *&
+        {
+            return *static_cast<void **>(static_cast<void *>(storage.data()));
+        }
+
+        auto moveFrom(BasicUniqueAny &other) noexcept -> void
         {
-            if (!storesTrivialObject && pointerAndDeleter.deleter != nullptr) {
-                pointerAndDeleter.deleter(pointerAndDeleter.pointer);
+            if (other.descriptor == nullptr) {
+                descriptor = nullptr;
+                return;
+            }
+
+            if (other.descriptor->relocate == nullptr) {
+                storage = other.storage;
+            } else {
+                other.descriptor->relocate(storage.data(), other.storage.data());
             }
+
+            descriptor = std::exchange(other.descriptor, nullptr);
         }
 
-        auto clearInternalStorage() -> void
+        auto deleteStoredObject() noexcept -> void
         {
-            deleteStoredObject();
-            rowBuffer.fill(std::byte{0});
-            clearTypeInfo();
+            if (descriptor != nullptr) {
+                descriptor->destroy(storage.data());
+            }
         }
 
-        auto clearTypeInfo() -> void
+        auto clearInternalStorage() noexcept -> void
         {
-            typeIndex = std::type_index{typeid(std::nullopt_t)};
-            storesTrivialObject = false;
+            deleteStoredObject();
+            descriptor = nullptr;
         }
 
         template <typename T>
         auto checkTypeMatch() const -> void
         {
-            if (std::type_index{typeid(T)} != typeIndex) {
+            if (descriptor == nullptr
+                || (descriptor->typeInfo != &typeid(T) && *descriptor->typeInfo != typeid(T))) {
                 throw bad_unique_any_cast{
                     std::string{"An attempt to get object of type "} + typeid(T).name()
-                    + ", but stored object has type {}" + typeIndex.name()};
+                    + ", but stored object has type " + getTypeIndex().name()};
             }
         }
     };
 
-    template <typename T>
-    [[nodiscard]] auto get(UniqueAny &unique_any) -> T
+    using UniqueAny = BasicUniqueAny<sizeof(void *) * 4>;
+
+    template <typename T, std::size_t BufferSize>
+    [[nodiscard]] auto get(BasicUniqueAny<BufferSize> &unique_any) -> T
     {
-        return unique_any.get<T>();
+        return unique_any.template get<T>();
     }
 
-    template <typename T>
-    [[nodiscard]] auto get(UniqueAny &&unique_any) -> T
+    template <typename T, std::size_t BufferSize>
+    [[nodiscard]] auto get(BasicUniqueAny<BufferSize> &&unique_any) -> T
     {
-        return unique_any.get<T>();
+        return unique_any.template get<T>();
     }
 
-    template <typename T>
-    [[nodiscard]] auto observe(UniqueAny &unique_any) -> T *
+    template <typename T, std::size_t BufferSize>
+    [[nodiscard]] auto observe(BasicUniqueAny<BufferSize> &unique_any) -> T *
     {
-        return unique_any.observe<T>();
+        return unique_any.template observe<T>();
     }
 
     template <typename T, typename... Ts>
@@ -3,9 +3,11 @@
 
 #include <bit>
 #include <cstddef>
+#include <isl/detail/unicode.hpp>
 #include <isl/isl.hpp>
 #include <iterator>
 #include <numeric>
+#include <span>
 
 namespace isl::utf8
 {
@@ -39,6 +41,10 @@ namespace isl::utf8
 
         constexpr inline std::array UtfMasks{
             0_B, OneByteMask, TwoBytesMask, TreeBytesMask, FourBytesMask};
+
+        // Size of a sequence by the number of leading ones in its first byte, zero for
+        // continuation bytes and bytes which never start a sequence.
+        constexpr inline std::array<u16, 9> SizeByLeadingOnes{1, 0, 2, 3, 4, 0, 0, 0, 0};
     } // namespace detail
 
     ISL_DECL auto isTrailingCharacter(char chr) noexcept -> bool
@@ -73,23 +79,123 @@ namespace isl::utf8
 
     ISL_DECL auto size(char chr) noexcept -> u16
     {
-        if (isOneByteSize(chr)) [[likely]] {
-            return 1;
+        return detail::SizeByLeadingOnes[as<std::size_t>(std::countl_one(as<u8>(chr)))];
+    }
+
+    namespace detail
+    {
+        // Returns size of the sequence at the beginning of the range if it is a well-formed
+        // UTF-8 sequence (Unicode Table 3-7) and zero otherwise.
+        ISL_DECL auto validSequenceSize(const char *data, std::size_t available) noexcept -> u16
+        {
+            const auto lead = as<u8>(data[0]);
+
+            if (lead < 0x80) [[likely]] {
+                return 1;
+            }
+
+            const auto sequence_size = utf8::size(data[0]);
+
+            // NOLINTBEGIN
+            if (lead < 0xC2 || lead > 0xF4 || sequence_size > available) {
+                return 0;
+            }
+
+            auto lower = u8{0x80};
+            auto upper = u8{0xBF};
+
+            switch (lead) {
+            case 0xE0:
+                lower = 0xA0;
+                break;
+
+            case 0xED:
+                upper = 0x9F;
+                break;
+
+            case 0xF0:
+                lower = 0x90;
+                break;
+
+            case 0xF4:
+                upper = 0x8F;
+                break;
+
+            default:
+                break;
+            }
+            // NOLINTEND
+
+            const auto second = as<u8>(data[1]);
+
+            if (second < lower || second > upper) {
+                return 0;
+            }
+
+            for (std::size_t i = 2; i < sequence_size; ++i) {
+                if (!isTrailingCharacter(data[i])) {
+                    return 0;
+                }
+            }
+
+            return sequence_size;
         }
 
-        if (isTwoBytesSize(chr)) [[unlikely]] {
-            return 2;
+        ISL_DECL auto
+            findFirstInvalidScalar(const char *data, std::size_t first, std::size_t last) noexcept
+            -> std::size_t
+        {
+            while (first < last) {
+                const auto sequence_size = validSequenceSize(data + first, last - first);
+
+                if (sequence_size == 0) {
+                    return first;
+                }
+
+                first += sequence_size;
+            }
+
+            return last;
+        }
+
+        ISL_DECL auto countCodePointsScalar(const char *data, std::size_t size) noexcept
+            -> std::size_t
+        {
+            auto result = std::size_t{};
+
+            for (std::size_t i = 0; i != size; ++i) {
+                result += as<std::size_t>(!isTrailingCharacter(data[i]));
+            }
+
+            return result;
         }
+    } // namespace detail
 
-        if (isThreeBytesSize(chr)) [[unlikely]] {
-            return 3;
+    // Returns index of the first byte of the first ill-formed sequence. Valid strings return
+    // their size, so the result is always the length of the longest valid prefix.
+    ISL_DECL auto findFirstInvalid(std::span<const char> str) noexcept -> std::size_t
+    {
+        if ISL_RUNTIME_BRANCH {
+            return isl::detail::unicode::findFirstInvalidUtf8(str.data(), str.size());
         }
 
-        if (isFourBytesSize(chr)) [[unlikely]] {
-            return 4;
+        return detail::findFirstInvalidScalar(str.data(), 0, str.size());
+    }
+
+    ISL_DECL auto validate(std::span<const char> str) noexcept -> bool
+    {
+        return findFirstInvalid(str) == str.size();
+    }
+
+    // Counts code points of a valid string. Every byte except continuation bytes is counted, so
+    // ill-formed strings give a meaningless but bounded result.
+    ISL_DECL auto countCodePoints(std::span<const char> str) noexcept -> std::size_t
+    {
+        if ISL_RUNTIME_BRANCH {
+            return isl::detail::unicode::countUtf8CodePoints(str.data(), str.size());
         }
 
-        return 0;
+        return detail::countCodePointsScalar(str.data(), str.size());
     }
 
     template <typename T>
@@ -137,6 +243,339 @@ namespace isl::utf8
         throw std::invalid_argument{"unable to convert symbol to utf8"};
         // NOLINTEND
     }
+
+    namespace detail
+    {
+        constexpr inline char32_t SurrogatesBegin = 0xD800;
+        constexpr inline char32_t LowSurrogatesBegin = 0xDC00;
+        constexpr inline char32_t SurrogatesEnd = 0xE000;
+        constexpr inline char32_t SupplementaryPlanesBegin = 0x10000;
+
+        ISL_DECL auto isSurrogate(char32_t chr) noexcept -> bool
+        {
+            return chr >= SurrogatesBegin && chr < SurrogatesEnd;
+        }
+
+        ISL_DECL auto isHighSurrogate(char32_t chr) noexcept -> bool
+        {
+            return chr >= SurrogatesBegin && chr < LowSurrogatesBegin;
+        }
+
+        // Reads code point of a valid sequence of the given size.
+        ISL_DECL auto decodeCodePoint(const char *data, u16 sequence_size) noexcept -> char32_t
+        {
+            auto chr = as<char32_t>(as<u8>(~UtfMasks[sequence_size]) & as<u8>(data[0]));
+
+            for (u16 i = 1; i < sequence_size; ++i) {
+                chr = (chr << TrailingSize) | (as<u8>(data[i]) & 0x3FU);// NOLINT
+            }
+
+            return chr;
+        }
+
+        ISL_DECL auto writeCodePoint(char32_t *buffer, char32_t chr) noexcept -> std::size_t
+        {
+            *buffer = chr;
+            return 1;
+        }
+
+        ISL_DECL auto writeCodePoint(char16_t *buffer, char32_t chr) noexcept -> std::size_t
+        {
+            if (chr < SupplementaryPlanesBegin) [[likely]] {
+                *buffer = as<char16_t>(chr);
+                return 1;
+            }
+
+            chr -= SupplementaryPlanesBegin;
+            buffer[0] = as<char16_t>(SurrogatesBegin + (chr >> 10U));      // NOLINT
+            buffer[1] = as<char16_t>(LowSurrogatesBegin + (chr & 0x3FFU));// NOLINT
+
+            return 2;
+        }
+
+        // Writes UTF-8 sequence of a valid code point and returns its size.
+        ISL_DECL auto encodeCodePoint(char32_t chr, char *buffer) noexcept -> std::size_t
+        {
+            // NOLINTBEGIN
+            if (chr <= OneByteMax) [[likely]] {
+                buffer[0] = as<char>(chr);
+                return 1;
+            }
+
+            if (chr <= TwoBytesMax) {
+                buffer[0] = as<char>(0xC0U | (chr >> 6U));
+                buffer[1] = as<char>(0x80U | (chr & 0x3FU));
+                return 2;
+            }
+
+            if (chr <= TreeBytesMax) {
+                buffer[0] = as<char>(0xE0U | (chr >> 12U));
+                buffer[1] = as<char>(0x80U | ((chr >> 6U) & 0x3FU));
+                buffer[2] = as<char>(0x80U | (chr & 0x3FU));
+                return 3;
+            }
+
+            buffer[0] = as<char>(0xF0U | (chr >> 18U));
+            buffer[1] = as<char>(0x80U | ((chr >> 12U) & 0x3FU));
+            buffer[2] = as<char>(0x80U | ((chr >> 6U) & 0x3FU));
+            buffer[3] = as<char>(0x80U | (chr & 0x3FU));
+            return 4;
+            // NOLINTEND
+        }
+
+        // Scalar conversions expect valid input and buffer of sufficient size, they return
+        // number of written characters.
+
+        template <typename CharT>
+        ISL_DECL auto decodeScalar(const char *data, std::size_t size, CharT *buffer) noexcept
+            -> std::size_t
+        {
+            auto written = std::size_t{};
+
+            for (std::size_t i = 0; i < size;) {
+                // ill-formed strings still move forward
+                const auto sequence_size = std::max<u16>(utf8::size(data[i]), 1);
+
+                const auto chr = decodeCodePoint(data + i, sequence_size);
+
+                written += writeCodePoint(buffer + written, chr);
+                i += sequence_size;
+            }
+
+            return written;
+        }
+
+        template <typename CharT>
+        ISL_DECL auto encodeScalar(const CharT *data, std::size_t size, char *buffer) noexcept
+            -> std::size_t
+        {
+            auto written = std::size_t{};
+
+            for (std::size_t i = 0; i != size; ++i) {
+                auto chr = as<char32_t>(data[i]);
+
+                if constexpr (std::same_as<CharT, char16_t>) {
+                    if (isHighSurrogate(chr) && i + 1 != size) {
+                        const auto low = as<char32_t>(data[++i]);
+                        chr = SupplementaryPlanesBegin + ((chr - SurrogatesBegin) << 10U)// NOLINT
+                              + (low - LowSurrogatesBegin);
+                    }
+                }
+
+                written += encodeCodePoint(chr, buffer + written);
+            }
+
+            return written;
+        }
+
+        ISL_DECL auto utf16SizeScalar(const char *data, std::size_t size) noexcept
+            -> std::size_t
+        {
+            auto result = std::size_t{};
+
+            for (std::size_t i = 0; i != size; ++i) {
+                result += as<std::size_t>(!isTrailingCharacter(data[i]))
+                          + as<std::size_t>(isFourBytesSize(data[i]));
+            }
+
+            return result;
+        }
+
+        ISL_DECL auto isValidUtf16(std::span<const char16_t> str) noexcept -> bool
+        {
+            for (std::size_t i = 0; i != str.size(); ++i) {
+                const auto chr = as<char32_t>(str[i]);
+
+                if (!isSurrogate(chr)) [[likely]] {
+                    continue;
+                }
+
+                if (!isHighSurrogate(chr) || i + 1 == str.size()) {
+                    return false;
+                }
+
+                const auto low = as<char32_t>(str[++i]);
+
+                if (!isSurrogate(low) || isHighSurrogate(low)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // Accumulates without early exit, so the loop is vectorized.
+        ISL_DECL auto isValidUtf32(std::span<const char32_t> str) noexcept -> bool
+        {
+            auto invalid = false;
+
+            for (const auto chr : str) {
+                invalid |= chr > FourBytesMax || isSurrogate(chr);
+            }
+
+            return !invalid;
+        }
+
+        template <typename CharT>
+        ISL_DECL auto decodeUnchecked(std::span<const char> str, std::span<CharT> buffer) noexcept
+            -> std::span<CharT>
+        {
+            if ISL_RUNTIME_BRANCH {
+                return buffer.first(
+                    isl::detail::unicode::decodeUtf8(str.data(), str.size(), buffer.data()));
+            }
+
+            return buffer.first(decodeScalar(str.data(), str.size(), buffer.data()));
+        }
+
+        template <typename CharT>
+        ISL_DECL auto encodeUnchecked(std::span<const CharT> str, std::span<char> buffer) noexcept
+            -> std::span<char>
+        {
+            if ISL_RUNTIME_BRANCH {
+                return buffer.first(
+                    isl::detail::unicode::encodeUtf8(str.data(), str.size(), buffer.data()));
+            }
+
+            return buffer.first(encodeScalar(str.data(), str.size(), buffer.data()));
+        }
+    } // namespace detail
+
+    // Sizes of converted strings, input strings are expected to be valid.
+
+    ISL_DECL auto utf16Size(std::span<const char> str) noexcept -> std::size_t
+    {
+        if ISL_RUNTIME_BRANCH {
+            return isl::detail::unicode::utf16SizeOfUtf8(str.data(), str.size());
+        }
+
+        return detail::utf16SizeScalar(str.data(), str.size());
+    }
+
+    ISL_DECL auto utf32Size(std::span<const char> str) noexcept -> std::size_t
+    {
+        return countCodePoints(str);
+    }
+
+    // Surrogates take 3 bytes each, while a pair of them is encoded by 4 bytes.
+    ISL_DECL auto encodedSize(std::span<const char16_t> str) noexcept -> std::size_t
+    {
+        auto result = str.size();
+
+        for (const auto chr : str) {
+            result += as<std::size_t>(chr > detail::OneByteMax)
+                      + as<std::size_t>(chr > detail::TwoBytesMax)
+                      - as<std::size_t>(detail::isSurrogate(chr));
+        }
+
+        return result;
+    }
+
+    ISL_DECL auto encodedSize(std::span<const char32_t> str) noexcept -> std::size_t
+    {
+        auto result = str.size();
+
+        for (const auto chr : str) {
+            result += as<std::size_t>(chr > detail::OneByteMax)
+                      + as<std::size_t>(chr > detail::TwoBytesMax)
+                      + as<std::size_t>(chr > detail::TreeBytesMax);
+        }
+
+        return result;
+    }
+
+    // Conversions write into the given buffer and return its written part. Safe versions throw
+    // std::invalid_argument for ill-formed input and std::length_error if the buffer is smaller
+    // than the converted string. Unsafe versions expect valid input and buffer of sufficient
+    // size, see utf16Size, utf32Size and encodedSize.
+
+    ISL_SAFE_VERSION
+    ISL_DECL auto decode(std::span<const char> str, std::span<char32_t> buffer)
+        -> std::span<char32_t>
+    {
+        if (!validate(str)) {
+            throw std::invalid_argument{"unable to decode ill-formed utf8"};
+        }
+
+        if (buffer.size() < utf32Size(str)) {
+            throw std::length_error{"buffer is too small for decoded utf8"};
+        }
+
+        return detail::decodeUnchecked(str, buffer);
+    }
+
+    ISL_UNSAFE_VERSION
+    ISL_DECL auto decode(std::span<const char> str, std::span<char32_t> buffer) noexcept
+        -> std::span<char32_t>
+    {
+        return detail::decodeUnchecked(str, buffer);
+    }
+
+    ISL_SAFE_VERSION
+    ISL_DECL auto decode(std::span<const char> str, std::span<char16_t> buffer)
+        -> std::span<char16_t>
+    {
+        if (!validate(str)) {
+            throw std::invalid_argument{"unable to decode ill-formed utf8"};
+        }
+
+        if (buffer.size() < utf16Size(str)) {
+            throw std::length_error{"buffer is too small for decoded utf8"};
+        }
+
+        return detail::decodeUnchecked(str, buffer);
+    }
+
+    ISL_UNSAFE_VERSION
+    ISL_DECL auto decode(std::span<const char> str, std::span<char16_t> buffer) noexcept
+        -> std::span<char16_t>
+    {
+        return detail::decodeUnchecked(str, buffer);
+    }
+
+    ISL_SAFE_VERSION
+    ISL_DECL auto encode(std::span<const char32_t> str, std::span<char> buffer)
+        -> std::span<char>
+    {
+        if (!detail::isValidUtf32(str)) {
+            throw std::invalid_argument{"unable to convert symbol to utf8"};
+        }
+
+        if (buffer.size() < encodedSize(str)) {
+            throw std::length_error{"buffer is too small for encoded utf8"};
+        }
+
+        return detail::encodeUnchecked(str, buffer);
+    }
+
+    ISL_UNSAFE_VERSION
+    ISL_DECL auto encode(std::span<const char32_t> str, std::span<char> buffer) noexcept
+        -> std::span<char>
+    {
+        return detail::encodeUnchecked(str, buffer);
+    }
+
+    ISL_SAFE_VERSION
+    ISL_DECL auto encode(std::span<const char16_t> str, std::span<char> buffer)
+        -> std::span<char>
+    {
+        if (!detail::isValidUtf16(str)) {
+            throw std::invalid_argument{"unable to convert ill-formed utf16 to utf8"};
+        }
+
+        if (buffer.size() < encodedSize(str)) {
+            throw std::length_error{"buffer is too small for encoded utf8"};
+        }
+
+        return detail::encodeUnchecked(str, buffer);
+    }
+
+    ISL_UNSAFE_VERSION
+    ISL_DECL auto encode(std::span<const char16_t> str, std::span<char> buffer) noexcept
+        -> std::span<char>
+    {
+        return detail::encodeUnchecked(str, buffer);
+    }
 } // namespace isl::utf8
 
 #endif /* CCL_PROJECT_UTF8_HPP */
@@ -4,17 +4,95 @@
 #include <ankerl/unordered_dense.h>
 #include <bitset>
 #include <isl/range.hpp>
+#include <isl/string_view.hpp>
+#include <span>
 
 namespace isl
 {
+    namespace detail
+    {
+        // Returns number of boundaries, which are not greater than chr. Boundaries are sorted
+        // starts and ends of half-open intervals, so chr is inside an interval if the number is
+        // odd. The search is branchless like the one of FlatMap.
+        ISL_DECL auto countBoundariesNotGreater(
+            const std::span<const char32_t> boundaries, const char32_t chr) noexcept
+            -> std::size_t
+        {
+            if (boundaries.empty()) {
+                return 0;
+            }
+
+            const auto *base = boundaries.data();
+            auto length = boundaries.size();
+
+            while (length > 1) {
+                const auto half = length / 2;
+                base += base[half] <= chr ? half : 0;
+                length -= half;
+            }
+
+            base += *base <= chr ? 1 : 0;
+            return as<std::size_t>(base - boundaries.data());
+        }
+
+        constexpr inline auto UtfSetPageBits = 6U;
+
+        // Tables of a set of code points. Bulk operations work with the tables, so they are
+        // shared by sets with any storage. ASCII characters are kept in a set of bytes, which
+        // vectorized byte search tests with shuffles. Sets without pages search all boundaries.
+        struct UtfSetTables
+        {
+            const string_search::ByteSet *ascii{};
+            std::span<const char32_t> boundaries;
+            // number of boundaries before each page, code points after the last page are
+            // searched in all boundaries from it
+            std::span<const u32> pages;
+
+            ISL_DECL auto at(const char32_t chr) const noexcept -> bool
+            {
+                if (chr < 128) {
+                    return ascii->contains(as<u8>(chr));
+                }
+
+                if (pages.empty()) {
+                    return countBoundariesNotGreater(boundaries, chr) % 2 != 0;
+                }
+
+                const auto page = std::min<std::size_t>(chr >> UtfSetPageBits, pages.size() - 1);
+                const auto first = pages[page];
+                const auto last = page + 1 == pages.size() ? boundaries.size() : pages[page + 1];
+                const auto page_boundaries = boundaries.subspan(first, last - first);
+
+                return (first + countBoundariesNotGreater(page_boundaries, chr)) % 2 != 0;
+            }
+
+            // Sets bit i % 64 of bits[i / 64] if chars[i] is in the set and clears bits of other
+            // characters. Throws std::length_error if bits are fewer than characters.
+            auto classify(std::span<const char32_t> chars, std::span<u64> bits) const -> void;
+
+            // Returns size in bytes of the longest prefix of a UTF-8 string, which has only code
+            // points of the set. Ill-formed sequences end the prefix.
+            [[nodiscard]] auto spanWhile(string_view str) const noexcept -> std::size_t;
+        };
+    }// namespace detail
+
+    // Set of code points. ASCII characters are kept in a bitmap, other code points are kept as
+    // sorted boundaries of disjoint intervals, so memory depends on the number of ranges
+    // instead of the number of code points. Lookup in the BMP searches only boundaries of a
+    // page of 64 code points, pages without boundaries are answered without a search. The page
+    // table ends at the last boundary in the BMP, so small sets keep small tables.
     class UtfSet
     {
     public:
         static constexpr auto asciiStorageSize = static_cast<std::size_t>(128);
+        static constexpr char32_t codePointsEnd = 0x110000;
 
     private:
-        std::bitset<asciiStorageSize> asciiSymbolsStorage;
-        ankerl::unordered_dense::set<char32_t> nonAsciiStorage;
+        detail::string_search::ByteSet asciiSymbols;
+        // starts and ends of half-open intervals, adjacent intervals are merged
+        std::vector<char32_t> nonAsciiBoundaries;
+        // pages of 64 code points up to the last boundary in the BMP, empty without boundaries
+        std::vector<u32> pageBoundariesBegin;
 
     public:
         UtfSet() = default;
@@ -22,8 +100,8 @@ namespace isl
         UtfSet(
             std::bitset<asciiStorageSize>
                 ascii_symbols,
-            ankerl::unordered_dense::set<char32_t>
-                non_ascii_symbols);
+            const ankerl::unordered_dense::set<char32_t>
+                &non_ascii_symbols);
 
         UtfSet(
             std::bitset<asciiStorageSize>
@@ -32,18 +110,228 @@ namespace isl
 
         [[nodiscard]] auto empty() const noexcept -> bool
         {
-            return asciiSymbolsStorage.none() && nonAsciiStorage.empty();
+            return asciiSymbols == detail::string_search::ByteSet{} && nonAsciiBoundaries.empty();
         }
 
-        [[nodiscard]] auto at(char32_t chr) const noexcept -> bool;
+        [[nodiscard]] auto at(const char32_t chr) const noexcept -> bool
+        {
+            return tables().at(chr);
+        }
+
+        // Returns number of intervals of non-ASCII code points.
+        [[nodiscard]] auto intervalsCount() const noexcept -> std::size_t
+        {
+            return nonAsciiBoundaries.size() / 2;
+        }
 
         auto set(char32_t chr, bool value = true) -> void;
-        
+
         auto set(Range<char32_t> range, bool value = true) -> void;
 
+        // Same as UtfSetTables::classify.
+        auto classify(const std::span<const char32_t> chars, const std::span<u64> bits) const
+            -> void
+        {
+            tables().classify(chars, bits);
+        }
+
+        // Same as UtfSetTables::spanWhile.
+        [[nodiscard]] auto spanWhile(const string_view str) const noexcept -> std::size_t
+        {
+            return tables().spanWhile(str);
+        }
+
+        // union, intersection and difference
+        friend auto operator|(const UtfSet &lhs, const UtfSet &rhs) -> UtfSet;
+        friend auto operator&(const UtfSet &lhs, const UtfSet &rhs) -> UtfSet;
+        friend auto operator-(const UtfSet &lhs, const UtfSet &rhs) -> UtfSet;
+
+        // complement in the range of code points
+        auto operator~() const -> UtfSet;
+
+        auto operator|=(const UtfSet &other) -> UtfSet &;
+        auto operator&=(const UtfSet &other) -> UtfSet &;
+        auto operator-=(const UtfSet &other) -> UtfSet &;
+
+        [[nodiscard]] auto operator==(const UtfSet &other) const noexcept -> bool
+        {
+            return asciiSymbols == other.asciiSymbols
+                   && nonAsciiBoundaries == other.nonAsciiBoundaries;
+        }
+
+    private:
+        static auto fromBoundaries(
+            const detail::string_search::ByteSet &ascii_symbols,
+            std::vector<char32_t> boundaries) -> UtfSet;
+
+        [[nodiscard]] auto tables() const noexcept -> detail::UtfSetTables
+        {
+            return {
+                .ascii = &asciiSymbols,
+                .boundaries = nonAsciiBoundaries,
+                .pages = pageBoundariesBegin,
+            };
+        }
+
+        template<typename Operation>
+        static auto combine(const UtfSet &lhs, const UtfSet &rhs, Operation operation) -> UtfSet;
+
+        auto setAscii(u8 chr, bool value) -> void;
+
+        auto setBigChars(char32_t first, char32_t last, bool value) -> void;
+
+        // Adds range that starts not before any of the added ones, pages are updated later.
+        auto appendSorted(char32_t first, char32_t last) -> void;
+
+        // Recounts boundaries before pages from the first one, boundary is a lower bound of
+        // its count.
+        auto updatePages(std::size_t first_page = 0, std::size_t boundary = 0) -> void;
+    };
+
+    // Set of code points built during compilation. ASCII characters, sorted boundaries of
+    // non-ASCII intervals and a page table are kept in arrays, so character classes are placed
+    // in read-only data and need neither heap nor initialization at startup. Members are public,
+    // so the set is a structural type: passed as a template argument it lets the compiler
+    // specialize lookups for the class. Pages cover 256 code points of the BMP and store small
+    // indices, so the table of a class takes a few hundred bytes.
+    template<std::size_t MaxBoundaries>
+    struct StaticUtfSet
+    {
+        static constexpr auto pageBits = 8U;
+        static constexpr auto bmpPagesCount = std::size_t{0x10000} >> pageBits;
+
+        using Index = std::conditional_t<
+            (MaxBoundaries <= std::numeric_limits<u8>::max()), u8,
+            std::conditional_t<(MaxBoundaries <= std::numeric_limits<u16>::max()), u16, u32>>;
+
+        detail::string_search::ByteSet asciiSymbols;
+        // starts and ends of half-open intervals, unused boundaries after them are zeros
+        std::array<char32_t, MaxBoundaries> nonAsciiBoundaries{};
+        std::size_t boundariesCount{};
+        // number of boundaries before each page of the BMP and before supplementary planes
+        std::array<Index, bmpPagesCount + 1> pageBoundariesBegin{};
+
+        consteval explicit StaticUtfSet(const std::span<const Range<char32_t>> ranges)
+        {
+            if (ranges.size() * 2 > MaxBoundaries) {
+                throw std::invalid_argument{"StaticUtfSet has not enough space for the ranges"};
+            }
+
+            auto sorted_ranges = std::vector<Range<char32_t>>{ranges.begin(), ranges.end()};
+
+            std::ranges::sort(sorted_ranges, {}, [](const Range<char32_t> range) {
+                return range.getFrom();
+            });
+
+            for (const auto range : sorted_ranges) {
+                appendSorted(range.getFrom(), range.getTo());
+            }
+
+            auto boundary = std::size_t{};
+
+            for (std::size_t page = 0; page != pageBoundariesBegin.size(); ++page) {
+                const auto page_begin = as<char32_t>(page << pageBits);
+
+                while (boundary != boundariesCount && nonAsciiBoundaries[boundary] < page_begin) {
+                    ++boundary;
+                }
+
+                pageBoundariesBegin[page] = as<Index>(boundary);
+            }
+        }
+
+        template<std::size_t RangesCount>
+        consteval explicit StaticUtfSet(const Range<char32_t> (&ranges)[RangesCount])// NOLINT
+          : StaticUtfSet{std::span<const Range<char32_t>>{ranges}}
+        {}
+
+        ISL_DECL auto empty() const noexcept -> bool
+        {
+            return asciiSymbols == detail::string_search::ByteSet{} && boundariesCount == 0;
+        }
+
+        ISL_DECL auto at(const char32_t chr) const noexcept -> bool
+        {
+            if (chr < UtfSet::asciiStorageSize) {
+                return asciiSymbols.contains(as<u8>(chr));
+            }
+
+            const auto page = std::min<std::size_t>(chr >> pageBits, bmpPagesCount);
+            const auto first = as<std::size_t>(pageBoundariesBegin[page]);
+            const auto last =
+                page == bmpPagesCount ? boundariesCount : pageBoundariesBegin[page + 1];
+            const auto page_boundaries =
+                std::span{nonAsciiBoundaries.data() + first, last - first};
+
+            return (first + detail::countBoundariesNotGreater(page_boundaries, chr)) % 2 != 0;
+        }
+
+        ISL_DECL auto intervalsCount() const noexcept -> std::size_t
+        {
+            return boundariesCount / 2;
+        }
+
+        // Same as UtfSetTables::classify. Non-ASCII code points are searched in all boundaries.
+        auto classify(const std::span<const char32_t> chars, const std::span<u64> bits) const
+            -> void
+        {
+            tables().classify(chars, bits);
+        }
+
+        // Same as UtfSetTables::spanWhile. Non-ASCII code points are searched in all boundaries.
+        [[nodiscard]] auto spanWhile(const string_view str) const noexcept -> std::size_t
+        {
+            return tables().spanWhile(str);
+        }
+
+        ISL_DECL auto tables() const noexcept -> detail::UtfSetTables
+        {
+            return {
+                .ascii = &asciiSymbols,
+                .boundaries = std::span{nonAsciiBoundaries.data(), boundariesCount},
+                .pages = {},
+            };
+        }
+
+        ISL_DECL auto operator==(const StaticUtfSet &other) const noexcept -> bool = default;
+
     private:
-        auto setBigChar(char32_t chr, bool value) -> void;
+        // Adds range that starts not before any of the added ones, touching ranges are merged.
+        constexpr auto appendSorted(char32_t first, const char32_t last) -> void
+        {
+            if (first > last || last > UtfSet::codePointsEnd) {
+                throw std::invalid_argument{"StaticUtfSet range is not a range of code points"};
+            }
+
+            for (; first < last && first < UtfSet::asciiStorageSize; ++first) {
+                asciiSymbols.add(as<u8>(first));
+            }
+
+            if (first >= last) {
+                return;
+            }
+
+            if (boundariesCount != 0 && first <= nonAsciiBoundaries[boundariesCount - 1]) {
+                auto &back = nonAsciiBoundaries[boundariesCount - 1];
+                back = std::max(back, last);
+                return;
+            }
+
+            nonAsciiBoundaries[boundariesCount++] = first;
+            nonAsciiBoundaries[boundariesCount++] = last;
+        }
     };
+
+    template<std::size_t RangesCount>
+    StaticUtfSet(const Range<char32_t> (&)[RangesCount])// NOLINT
+        -> StaticUtfSet<RangesCount * 2>;
+
+    template<std::size_t RangesCount>
+    consteval auto makeStaticUtfSet(const Range<char32_t> (&ranges)[RangesCount])// NOLINT
+        -> StaticUtfSet<RangesCount * 2>
+    {
+        return StaticUtfSet<RangesCount * 2>{ranges};
+    }
 }// namespace isl
 
 #endif /* CCL_PROJECT_UTF_SET_HPP */
@@ -0,0 +1,117 @@
+#include <ankerl/unordered_dense.h>
+#include <isl/id_generator.hpp>
+#include <isl/ref_counter.hpp>
+#include <mutex>
+
+namespace isl
+{
+    using BiasedCounter = RefCounter<RefCountPolicy::BIASED>;
+
+    namespace
+    {
+        class BiasedOwnerQueue;
+
+        constinit IdGenerator<u64> BiasedThreadTokenGenerator{1}; // NOLINT
+        std::mutex BiasedOwnersLock;                              // NOLINT
+        ankerl::unordered_dense::map<u64, BiasedOwnerQueue *> BiasedOwners; // NOLINT
+
+        class BiasedOwnerQueue
+        {
+        private:
+            std::vector<const BiasedCounter *> pending;
+            std::atomic<bool> hasPending{false};
+            u64 token{detail::CurrentBiasedThreadToken};
+
+        public:
+            BiasedOwnerQueue()
+            {
+                const auto lock = std::scoped_lock{BiasedOwnersLock};
+                BiasedOwners.emplace(token, this);
+            }
+
+            BiasedOwnerQueue(const BiasedOwnerQueue &) = delete;
+            BiasedOwnerQueue(BiasedOwnerQueue &&) = delete;
+
+            ~BiasedOwnerQueue()
+            {
+                {
+                    const auto lock = std::scoped_lock{BiasedOwnersLock};
+                    BiasedOwners.erase(token);
+                }
+
+                // nobody can queue counters to us anymore
+                for (const auto *counter : pending) {
+                    counter->mergeQueued();
+                }
+            }
+
+            auto operator=(const BiasedOwnerQueue &) -> BiasedOwnerQueue & = delete;
+            auto operator=(BiasedOwnerQueue &&) -> BiasedOwnerQueue & = delete;
+
+            [[nodiscard]] auto getToken() const noexcept -> u64
+            {
+                return token;
+            }
+
+            // must be called with BiasedOwnersLock held
+            auto push(const BiasedCounter *counter) -> void
+            {
+                pending.emplace_back(counter);
+                hasPending.store(true, std::memory_order_release);
+            }
+
+            auto drain() -> void
+            {
+                if (!hasPending.load(std::memory_order_acquire)) {
+                    return;
+                }
+
+                auto to_merge = std::vector<const BiasedCounter *>{};
+
+                {
+                    const auto lock = std::scoped_lock{BiasedOwnersLock};
+                    std::swap(to_merge, pending);
+                    hasPending.store(false, std::memory_order_relaxed);
+                }
+
+                for (const auto *counter : to_merge) {
+                    counter->mergeQueued();
+                }
+            }
+        };
+
+        thread_local BiasedOwnerQueue LocalBiasedOwnerQueue; // NOLINT
+    } // namespace
+
+    auto detail::nextBiasedThreadToken() noexcept -> u64
+    {
+        return BiasedThreadTokenGenerator.next();
+    }
+
+    auto detail::registerBiasedOwner() -> u64
+    {
+        LocalBiasedOwnerQueue.drain();
+        return LocalBiasedOwnerQueue.getToken();
+    }
+
+    auto detail::queueBiasedRelease(const BiasedCounter *counter) -> void
+    {
+        {
+            const auto lock = std::scoped_lock{BiasedOwnersLock};
+            const auto owner_it = BiasedOwners.find(counter->getOwnerToken());
+
+            if (owner_it != BiasedOwners.end()) {
+                owner_it->second->push(counter);
+                return;
+            }
+        }
+
+        // owner has exited, its last writes are visible through BiasedOwnersLock
+        counter->mergeQueued();
+    }
+
+    auto processDeferredBiasedReleases() -> void
+    {
+        LocalBiasedOwnerQueue.drain();
+    }
+} // namespace isl
@@ -0,0 +1,116 @@
+#include <isl/string_interner.hpp>
+#include <mutex>
+
+namespace isl
+{
+    auto StringInterner::Shard::store(const string_view str) -> string_view
+    {
+        if (str.empty()) {
+            return {};
+        }
+
+        // long strings get their own block, so they do not waste the rest of the current one
+        if (str.size() > arenaBlockSize / 4) {
+            auto &block = arenaBlocks.emplace_back(
+                std::make_unique_for_overwrite<char[]>(str.size())); // NOLINT
+            std::ranges::copy(str, block.get());
+
+            return {block.get(), str.size()};
+        }
+
+        if (str.size() > arenaAvailable) {
+            auto &block = arenaBlocks.emplace_back(
+                std::make_unique_for_overwrite<char[]>(arenaBlockSize)); // NOLINT
+            arenaPosition = block.get();
+            arenaAvailable = arenaBlockSize;
+        }
+
+        auto *stored = arenaPosition;
+        std::ranges::copy(str, stored);
+
+        arenaPosition += str.size();
+        arenaAvailable -= str.size();
+
+        return {stored, str.size()};
+    }
+
+    auto StringInterner::intern(const string_view str) -> InternedString
+    {
+        const auto shard_index = getShardIndex(str);
+        auto &shard = shards[shard_index];
+
+        {
+            const auto lock = std::shared_lock{shard.lock};
+
+            if (const auto it = shard.ids.find(str); it != shard.ids.end()) {
+                return {it->second, it->first};
+            }
+        }
+
+        const auto lock = std::scoped_lock{shard.lock};
+
+        // another thread could insert the string while no lock was held
+        if (const auto it = shard.ids.find(str); it != shard.ids.end()) {
+            return {it->second, it->first};
+        }
+
+        const auto id = makeId(shard_index, shard.strings.size());
+        const auto stored = shard.store(str);
+
+        shard.strings.emplace_back(stored);
+        shard.ids.emplace(stored, id);
+
+        return {id, stored};
+    }
+
+    auto StringInterner::find(const string_view str) const -> Optional<InternedString>
+    {
+        const auto &shard = shards[getShardIndex(str)];
+        const auto lock = std::shared_lock{shard.lock};
+
+        if (const auto it = shard.ids.find(str); it != shard.ids.end()) {
+            return InternedString{it->second, it->first};
+        }
+
+        return std::nullopt;
+    }
+
+    auto StringInterner::getString(const SmallId id) const -> string_view
+    {
+        const auto &shard = shards[id & (shardsCount - 1)];
+        const auto lock = std::shared_lock{shard.lock};
+
+        return shard.strings[id >> shardBits];
+    }
+
+    auto StringInterner::size() const -> std::size_t
+    {
+        auto result = std::size_t{};
+
+        for (const auto &shard : shards) {
+            const auto lock = std::shared_lock{shard.lock};
+            result += shard.strings.size();
+        }
+
+        return result;
+    }
+
+    auto StringInterner::getShardIndex(const string_view str) noexcept -> std::size_t
+    {
+        // the map inside the shard takes fingerprints from the low 8 bits of the same hash and
+        // buckets from the high ones, so the shard is chosen by the bits right above the
+        // fingerprint
+        const auto hash = ankerl::unordered_dense::hash<string_view>{}(str);
+        return (hash >> 8U) & (shardsCount - 1);
+    }
+
+    auto StringInterner::makeId(const std::size_t shard_index, const std::size_t index_in_shard)
+        -> SmallId
+    {
+        if (index_in_shard > maxStringsPerShard) {
+            throw std::length_error{"StringInterner shard is full"};
+        }
+
+        return static_cast<SmallId>((index_in_shard << shardBits) | shard_index);
+    }
+} // namespace isl
@@ -0,0 +1,1186 @@
+#include <bit>
+#include <cstring>
+#include <isl/detail/simd_dispatch.hpp>
+#include <isl/detail/string_search.hpp>
+#include <string_view>
+
+namespace isl::detail::string_search
+{
+    ISL_SIMD_KERNELS_BEGIN
+
+    namespace
+    {
+        auto findByteScalar(
+            const char *data, const std::size_t first, const std::size_t last,
+            const char chr) noexcept -> std::size_t
+        {
+            for (auto index = first; index != last; ++index) {
+                if (data[index] == chr) {
+                    return index;
+                }
+            }
+
+            return npos;
+        }
+
+        auto findLastByteScalar(const char *data, std::size_t last, const char chr) noexcept
+            -> std::size_t
+        {
+            while (last != 0) {
+                if (data[--last] == chr) {
+                    return last;
+                }
+            }
+
+            return npos;
+        }
+
+        template<bool InSet>
+        auto findFirstOfScalar(
+            const char *data, const std::size_t first, const std::size_t last,
+            const ByteSet &set) noexcept -> std::size_t
+        {
+            for (auto index = first; index != last; ++index) {
+                if (set.contains(static_cast<u8>(data[index])) == InSet) {
+                    return index;
+                }
+            }
+
+            return npos;
+        }
+
+        template<bool InSet>
+        auto findLastOfScalar(const char *data, std::size_t last, const ByteSet &set) noexcept
+            -> std::size_t
+        {
+            while (last != 0) {
+                if (set.contains(static_cast<u8>(data[--last])) == InSet) {
+                    return last;
+                }
+            }
+
+            return npos;
+        }
+
+        auto findSubstringScalar(
+            const char *data, const std::size_t first, const std::size_t size,
+            const char *substring, const std::size_t substring_size) noexcept -> std::size_t
+        {
+            const auto result = std::string_view{data, size}.find(
+                std::string_view{substring, substring_size}, first);
+
+            return result == std::string_view::npos ? npos : result;
+        }
+
+        auto findMismatchScalar(
+            const char *lhs, const char *rhs, const std::size_t first,
+            const std::size_t size) noexcept -> std::size_t
+        {
+            for (auto index = first; index != size; ++index) {
+                if (lhs[index] != rhs[index]) {
+                    return index;
+                }
+            }
+
+            return npos;
+        }
+
+        // State of the range scan after some character.
+        struct RangeState
+        {
+            std::ptrdiff_t depth{};
+            bool inString{};
+            bool escaped{};
+        };
+
+        auto depthChange(const char chr, const RangeDelimiters &delimiters) noexcept
+            -> std::ptrdiff_t
+        {
+            return static_cast<std::ptrdiff_t>(chr == delimiters.open)
+                   - static_cast<std::ptrdiff_t>(chr == delimiters.close);
+        }
+
+        template<bool QuoteAware>
+        auto findRangeEndScalar(
+            const char *data, const std::size_t first, const std::size_t last,
+            const RangeDelimiters &delimiters, RangeState &state) noexcept -> std::size_t
+        {
+            for (auto index = first; index != last; ++index) {
+                const auto chr = data[index];
+
+                if constexpr (QuoteAware) {
+                    if (state.escaped) {
+                        state.escaped = false;
+                    } else if (chr == delimiters.escape) {
+                        state.escaped = true;
+                    } else if (chr == delimiters.quote) {
+                        state.inString = !state.inString;
+                    } else if (!state.inString) {
+                        state.depth += depthChange(chr, delimiters);
+                    }
+                } else {
+                    state.depth += depthChange(chr, delimiters);
+                }
+
+                if (state.depth == 0) {
+                    return index;
+                }
+            }
+
+            return npos;
+        }
+
+        auto equalMask64Scalar(const char *data, const std::size_t size, const char chr) noexcept
+            -> u64
+        {
+            auto mask = u64{};
+
+            for (std::size_t index = 0; index != size; ++index) {
+                mask |= static_cast<u64>(data[index] == chr) << index;
+            }
+
+            return mask;
+        }
+
+        auto setMask64Scalar(const char *data, const std::size_t size, const ByteSet &set) noexcept
+            -> u64
+        {
+            auto mask = u64{};
+
+            for (std::size_t index = 0; index != size; ++index) {
+                mask |= static_cast<u64>(set.contains(static_cast<u8>(data[index]))) << index;
+            }
+
+            return mask;
+        }
+
+        struct Scalar
+        {
+            static auto findByte(const char *data, const std::size_t size, const char chr) noexcept
+                -> std::size_t
+            {
+                return findByteScalar(data, 0, size, chr);
+            }
+
+            static auto
+                findLastByte(const char *data, const std::size_t size, const char chr) noexcept
+                -> std::size_t
+            {
+                return findLastByteScalar(data, size, chr);
+            }
+
+            template<bool InSet>
+            static auto findFirstOf(
+                const char *data, const std::size_t size, const ByteSet &set) noexcept
+                -> std::size_t
+            {
+                return findFirstOfScalar<InSet>(data, 0, size, set);
+            }
+
+            template<bool InSet>
+            static auto findLastOf(
+                const char *data, const std::size_t size, const ByteSet &set) noexcept
+                -> std::size_t
+            {
+                return findLastOfScalar<InSet>(data, size, set);
+            }
+
+            static auto findSubstring(
+                const char *data, const std::size_t size, const char *substring,
+                const std::size_t substring_size) noexcept -> std::size_t
+            {
+                return findSubstringScalar(data, 0, size, substring, substring_size);
+            }
+
+            static auto
+                findMismatch(const char *lhs, const char *rhs, const std::size_t size) noexcept
+                -> std::size_t
+            {
+                return findMismatchScalar(lhs, rhs, 0, size);
+            }
+
+            static auto
+                equalMask64(const char *data, const std::size_t size, const char chr) noexcept
+                -> u64
+            {
+                return equalMask64Scalar(data, size, chr);
+            }
+
+            static auto
+                setMask64(const char *data, const std::size_t size, const ByteSet &set) noexcept
+                -> u64
+            {
+                return setMask64Scalar(data, size, set);
+            }
+
+            template<bool QuoteAware>
+            static auto findRangeEnd(
+                const char *data, const std::size_t size,
+                const RangeDelimiters &delimiters) noexcept -> std::size_t
+            {
+                auto state = RangeState{};
+                return findRangeEndScalar<QuoteAware>(data, 0, size, delimiters, state);
+            }
+        };
+
+        // Masks returned by an instruction set have one bit per byte lane, lanes are
+        // bitsPerLane bits apart.
+        template<typename Isa>
+        ISL_INLINE auto firstLane(const typename Isa::Mask mask) noexcept -> std::size_t
+        {
+            return static_cast<std::size_t>(std::countr_zero(mask)) / Isa::bitsPerLane;
+        }
+
+        template<typename Isa>
+        ISL_INLINE auto lastLane(const typename Isa::Mask mask) noexcept -> std::size_t
+        {
+            constexpr auto mask_bits = sizeof(typename Isa::Mask) * 8;
+            const auto highest_bit =
+                mask_bits - 1 - static_cast<std::size_t>(std::countl_zero(mask));
+
+            return highest_bit / Isa::bitsPerLane;
+        }
+
+        // When the string does not split into whole blocks, the last block overlaps already
+        // checked characters. They have no matches, so the block is searched as is and only
+        // strings shorter than a block are searched by scalar loops. The same holds for all
+        // kernels below.
+        template<typename Isa>
+        ISL_INLINE auto
+            findByteKernel(const char *data, const std::size_t size, const char chr) noexcept
+            -> std::size_t
+        {
+            const auto needle = Isa::broadcast(chr);
+            auto index = std::size_t{};
+
+            for (; index + Isa::width <= size; index += Isa::width) {
+                const auto mask = Isa::equalMask(Isa::load(data + index), needle);
+
+                if (mask != 0) {
+                    return index + firstLane<Isa>(mask);
+                }
+            }
+
+            if (index != size && size >= Isa::width) {
+                const auto block_begin = size - Isa::width;
+                const auto mask = Isa::equalMask(Isa::load(data + block_begin), needle);
+
+                return mask != 0 ? block_begin + firstLane<Isa>(mask) : npos;
+            }
+
+            return findByteScalar(data, index, size, chr);
+        }
+
+        template<typename Isa>
+        ISL_INLINE auto
+            findLastByteKernel(const char *data, const std::size_t size, const char chr) noexcept
+            -> std::size_t
+        {
+            const auto needle = Isa::broadcast(chr);
+            auto last = size;
+
+            for (; last >= Isa::width; last -= Isa::width) {
+                const auto block_begin = last - Isa::width;
+                const auto mask = Isa::equalMask(Isa::load(data + block_begin), needle);
+
+                if (mask != 0) {
+                    return block_begin + lastLane<Isa>(mask);
+                }
+            }
+
+            if (last != 0 && size >= Isa::width) {
+                const auto mask = Isa::equalMask(Isa::load(data), needle);
+                return mask != 0 ? lastLane<Isa>(mask) : npos;
+            }
+
+            return findLastByteScalar(data, last, chr);
+        }
+
+        template<typename Isa, bool InSet>
+        ISL_INLINE auto setMask(
+            const typename Isa::Vector &block, const typename Isa::SetTables &tables) noexcept
+            -> typename Isa::Mask
+        {
+            const auto mask = Isa::setMask(block, tables);
+
+            if constexpr (InSet) {
+                return mask;
+            } else {
+                return ~mask & Isa::fullMask;
+            }
+        }
+
+        template<typename Isa, bool InSet>
+        ISL_INLINE auto
+            findFirstOfKernel(const char *data, const std::size_t size, const ByteSet &set) noexcept
+            -> std::size_t
+        {
+            const auto tables = typename Isa::SetTables{set};
+            auto index = std::size_t{};
+
+            for (; index + Isa::width <= size; index += Isa::width) {
+                const auto mask = setMask<Isa, InSet>(Isa::load(data + index), tables);
+
+                if (mask != 0) {
+                    return index + firstLane<Isa>(mask);
+                }
+            }
+
+            if (index != size && size >= Isa::width) {
+                const auto block_begin = size - Isa::width;
+                const auto mask = setMask<Isa, InSet>(Isa::load(data + block_begin), tables);
+
+                return mask != 0 ? block_begin + firstLane<Isa>(mask) : npos;
+            }
+
+            return findFirstOfScalar<InSet>(data, index, size, set);
+        }
+
+        template<typename Isa, bool InSet>
+        ISL_INLINE auto
+            findLastOfKernel(const char *data, const std::size_t size, const ByteSet &set) noexcept
+            -> std::size_t
+        {
+            const auto tables = typename Isa::SetTables{set};
+            auto last = size;
+
+            for (; last >= Isa::width; last -= Isa::width) {
+                const auto block_begin = last - Isa::width;
+                const auto mask = setMask<Isa, InSet>(Isa::load(data + block_begin), tables);
+
+                if (mask != 0) {
+                    return block_begin + lastLane<Isa>(mask);
+                }
+            }
+
+            if (last != 0 && size >= Isa::width) {
+                const auto mask = setMask<Isa, InSet>(Isa::load(data), tables);
+                return mask != 0 ? lastLane<Isa>(mask) : npos;
+            }
+
+            return findLastOfScalar<InSet>(data, last, set);
+        }
+
+        template<typename Isa>
+        ISL_INLINE auto findSubstringInBlock(
+            const char *data, const std::size_t block_begin,
+            const typename Isa::Vector &first_character, const typename Isa::Vector &last_character,
+            const char *substring, const std::size_t substring_size) noexcept -> std::size_t
+        {
+            const auto last_offset = substring_size - 1;
+            const auto first_block = Isa::load(data + block_begin);
+            const auto last_block = Isa::load(data + block_begin + last_offset);
+
+            auto mask = Isa::equalMask(first_block, first_character)
+                        & Isa::equalMask(last_block, last_character);
+
+            while (mask != 0) {
+                const auto position = block_begin + firstLane<Isa>(mask);
+
+                if (std::memcmp(data + position + 1, substring + 1, substring_size - 2) == 0) {
+                    return position;
+                }
+
+                mask &= mask - 1;
+            }
+
+            return npos;
+        }
+
+        // Positions where both the first and the last characters of the substring match are
+        // found for a whole block at once, only they are compared with memcmp. Substring must
+        // be at least 2 characters long and not longer than the string.
+        template<typename Isa>
+        ISL_INLINE auto findSubstringKernel(
+            const char *data, const std::size_t size, const char *substring,
+            const std::size_t substring_size) noexcept -> std::size_t
+        {
+            const auto first_character = Isa::broadcast(substring[0]);
+            const auto last_character = Isa::broadcast(substring[substring_size - 1]);
+            const auto last_offset = substring_size - 1;
+
+            auto index = std::size_t{};
+
+            for (; index + last_offset + Isa::width <= size; index += Isa::width) {
+                const auto position = findSubstringInBlock<Isa>(
+                    data, index, first_character, last_character, substring, substring_size);
+
+                if (position != npos) {
+                    return position;
+                }
+            }
+
+            const auto positions_count = size - last_offset;
+
+            if (index != positions_count && positions_count >= Isa::width) {
+                const auto block_begin = positions_count - Isa::width;
+                return findSubstringInBlock<Isa>(
+                    data, block_begin, first_character, last_character, substring,
+                    substring_size);
+            }
+
+            return findSubstringScalar(data, index, size, substring, substring_size);
+        }
+
+        template<typename Isa>
+        ISL_INLINE auto differenceMask(const char *lhs, const char *rhs) noexcept
+            -> typename Isa::Mask
+        {
+            const auto mask = Isa::equalMask(Isa::load(lhs), Isa::load(rhs));
+            return ~mask & Isa::fullMask;
+        }
+
+        template<typename Isa>
+        ISL_INLINE auto
+            findMismatchKernel(const char *lhs, const char *rhs, const std::size_t size) noexcept
+            -> std::size_t
+        {
+            auto index = std::size_t{};
+
+            for (; index + Isa::width <= size; index += Isa::width) {
+                const auto mask = differenceMask<Isa>(lhs + index, rhs + index);
+
+                if (mask != 0) {
+                    return index + firstLane<Isa>(mask);
+                }
+            }
+
+            if (index != size && size >= Isa::width) {
+                const auto block_begin = size - Isa::width;
+                const auto mask = differenceMask<Isa>(lhs + block_begin, rhs + block_begin);
+
+                return mask != 0 ? block_begin + firstLane<Isa>(mask) : npos;
+            }
+
+            return findMismatchScalar(lhs, rhs, index, size);
+        }
+
+        // Bit i of the result is xor of bits from 0 to i of the value.
+        ISL_INLINE auto prefixXor(u64 value) noexcept -> u64
+        {
+            value ^= value << 1U;
+            value ^= value << 2U;
+            value ^= value << 4U;
+            value ^= value << 8U;
+            value ^= value << 16U;
+            value ^= value << 32U;
+
+            return value;
+        }
+
+        // Returns bits of characters that follow an unescaped escape character. Carry tells
+        // whether the first character of the block is escaped by the end of the previous one and
+        // receives the same for the next block.
+        ISL_INLINE auto escapedMask(u64 escapes, bool &carry) noexcept -> u64
+        {
+            auto escaped = static_cast<u64>(carry);
+            carry = false;
+
+            for (; escapes != 0; escapes &= escapes - 1) {
+                const auto position = std::countr_zero(escapes);
+
+                if (((escaped >> position) & 1U) != 0) {
+                    continue;
+                }
+
+                if (position == 63) {
+                    carry = true;
+                } else {
+                    escaped |= u64{2} << position;
+                }
+            }
+
+            return escaped;
+        }
+
+        // Every 64 characters are classified into bitmasks of opening and closing characters at
+        // once. Depth can reach zero inside a block only if the block has enough characters
+        // moving it towards zero, such blocks are rare and only they are walked bit by bit.
+        // Quotes and escapes are masked out the same way: prefix xor of unescaped quotes gives
+        // the characters inside strings.
+        template<typename Isa, bool QuoteAware>
+        ISL_INLINE auto findRangeEndKernel(
+            const char *data, const std::size_t size, const RangeDelimiters &delimiters) noexcept
+            -> std::size_t
+        {
+            constexpr auto block_size = std::size_t{64};
+
+            if (size == 0) {
+                return npos;
+            }
+
+            // depth after the first character is zero unless it opens the range
+            auto state = RangeState{};
+
+            if (findRangeEndScalar<QuoteAware>(data, 0, 1, delimiters, state) != npos) {
+                return 0;
+            }
+
+            const auto open = Isa::broadcast(delimiters.open);
+            const auto close = Isa::broadcast(delimiters.close);
+            const auto quote = Isa::broadcast(delimiters.quote);
+            const auto escape = Isa::broadcast(delimiters.escape);
+
+            auto index = std::size_t{1};
+
+            for (; index + block_size <= size; index += block_size) {
+                const auto block = Isa::load64(data + index);
+
+                auto opens = Isa::equalMask64(block, open);
+                auto closes = Isa::equalMask64(block, close);
+
+                if constexpr (QuoteAware) {
+                    const auto escaped =
+                        escapedMask(Isa::equalMask64(block, escape), state.escaped);
+                    auto in_string = prefixXor(Isa::equalMask64(block, quote) & ~escaped);
+
+                    if (state.inString) {
+                        in_string = ~in_string;
+                    }
+
+                    state.inString = (in_string >> 63U) != 0;
+
+                    const auto code = ~(escaped | in_string);
+                    opens &= code;
+                    closes &= code;
+                }
+
+                const auto opens_count = static_cast<std::ptrdiff_t>(std::popcount(opens));
+                const auto closes_count = static_cast<std::ptrdiff_t>(std::popcount(closes));
+
+                const auto may_reach_zero =
+                    state.depth > 0 ? closes_count >= state.depth : opens_count >= -state.depth;
+
+                if (!may_reach_zero) {
+                    state.depth += opens_count - closes_count;
+                    continue;
+                }
+
+                for (auto changes = opens | closes; changes != 0; changes &= changes - 1) {
+                    const auto position = std::countr_zero(changes);
+
+                    state.depth += ((opens >> position) & 1U) != 0 ? 1 : -1;
+
+                    if (state.depth == 0) {
+                        return index + static_cast<std::size_t>(position);
+                    }
+                }
+            }
+
+            return findRangeEndScalar<QuoteAware>(data, index, size, delimiters, state);
+        }
+
+        // Functions of an instruction set with kernels instantiated for it.
+        template<typename Isa>
+        struct Kernels
+        {
+            static auto findByte(const char *data, const std::size_t size, const char chr) noexcept
+                -> std::size_t
+            {
+                return findByteKernel<Isa>(data, size, chr);
+            }
+
+            static auto
+                findLastByte(const char *data, const std::size_t size, const char chr) noexcept
+                -> std::size_t
+            {
+                return findLastByteKernel<Isa>(data, size, chr);
+            }
+
+            template<bool InSet>
+            static auto findFirstOf(
+                const char *data, const std::size_t size, const ByteSet &set) noexcept
+                -> std::size_t
+            {
+                return findFirstOfKernel<Isa, InSet>(data, size, set);
+            }
+
+            template<bool InSet>
+            static auto findLastOf(
+                const char *data, const std::size_t size, const ByteSet &set) noexcept
+                -> std::size_t
+            {
+                return findLastOfKernel<Isa, InSet>(data, size, set);
+            }
+
+            static auto findSubstring(
+                const char *data, const std::size_t size, const char *substring,
+                const std::size_t substring_size) noexcept -> std::size_t
+            {
+                return findSubstringKernel<Isa>(data, size, substring, substring_size);
+            }
+
+            static auto
+                findMismatch(const char *lhs, const char *rhs, const std::size_t size) noexcept
+                -> std::size_t
+            {
+                return findMismatchKernel<Isa>(lhs, rhs, size);
+            }
+
+            static auto
+                equalMask64(const char *data, const std::size_t size, const char chr) noexcept
+                -> u64
+            {
+                if (size < 64) {
+                    return equalMask64Scalar(data, size, chr);
+                }
+
+                return Isa::equalMask64(Isa::load64(data), Isa::broadcast(chr));
+            }
+
+            static auto
+                setMask64(const char *data, const std::size_t size, const ByteSet &set) noexcept
+                -> u64
+            {
+                if (size < 64) {
+                    return setMask64Scalar(data, size, set);
+                }
+
+                return Isa::setMask64(Isa::load64(data), typename Isa::SetTables{set});
+            }
+
+            template<bool QuoteAware>
+            static auto findRangeEnd(
+                const char *data, const std::size_t size,
+                const RangeDelimiters &delimiters) noexcept -> std::size_t
+            {
+                return findRangeEndKernel<Isa, QuoteAware>(data, size, delimiters);
+            }
+        };
+
+#if defined(ISL_SIMD_X86)
+        struct Sse2
+        {
+            using Vector = __m128i;
+            using Mask = u32;
+
+            static constexpr std::size_t width = 16;
+            static constexpr std::size_t bitsPerLane = 1;
+            static constexpr Mask fullMask = 0xFFFF;
+
+            ISL_INLINE static auto load(const char *data) noexcept -> Vector
+            {
+                return _mm_loadu_si128(reinterpret_cast<const Vector *>(data));// NOLINT
+            }
+
+            ISL_INLINE static auto broadcast(const char chr) noexcept -> Vector
+            {
+                return _mm_set1_epi8(chr);
+            }
+
+            ISL_INLINE static auto equalMask(const Vector lhs, const Vector rhs) noexcept -> Mask
+            {
+                return static_cast<Mask>(_mm_movemask_epi8(_mm_cmpeq_epi8(lhs, rhs)));
+            }
+
+            struct Block64
+            {
+                Vector first;
+                Vector second;
+                Vector third;
+                Vector fourth;
+            };
+
+            ISL_INLINE static auto load64(const char *data) noexcept -> Block64
+            {
+                return {load(data), load(data + 16), load(data + 32), load(data + 48)};
+            }
+
+            ISL_INLINE static auto equalMask64(const Block64 &block, const Vector needle) noexcept
+                -> u64
+            {
+                return static_cast<u64>(equalMask(block.first, needle))
+                       | (static_cast<u64>(equalMask(block.second, needle)) << 16U)
+                       | (static_cast<u64>(equalMask(block.third, needle)) << 32U)
+                       | (static_cast<u64>(equalMask(block.fourth, needle)) << 48U);
+            }
+        };
+
+        struct Avx2
+        {
+            using Vector = __m256i;
+            using Mask = u32;
+
+            static constexpr std::size_t width = 32;
+            static constexpr std::size_t bitsPerLane = 1;
+            static constexpr Mask fullMask = ~Mask{};
+
+            struct SetTables
+            {
+                Vector lowRows;
+                Vector highRows;
+
+                ISL_TARGET_AVX2 explicit SetTables(const ByteSet &set) noexcept
+                  : lowRows{broadcastTable(set.getLowRows())}
+                  , highRows{broadcastTable(set.getHighRows())}
+                {}
+            };
+
+            ISL_TARGET_AVX2 static auto load(const char *data) noexcept -> Vector
+            {
+                return _mm256_loadu_si256(reinterpret_cast<const Vector *>(data));// NOLINT
+            }
+
+            ISL_TARGET_AVX2 static auto broadcast(const char chr) noexcept -> Vector
+            {
+                return _mm256_set1_epi8(chr);
+            }
+
+            ISL_TARGET_AVX2 static auto equalMask(const Vector lhs, const Vector rhs) noexcept
+                -> Mask
+            {
+                return static_cast<Mask>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(lhs, rhs)));
+            }
+
+            struct Block64
+            {
+                Vector low;
+                Vector high;
+            };
+
+            ISL_TARGET_AVX2 static auto load64(const char *data) noexcept -> Block64
+            {
+                return {load(data), load(data + 32)};
+            }
+
+            ISL_TARGET_AVX2 static auto
+                equalMask64(const Block64 &block, const Vector needle) noexcept -> u64
+            {
+                return static_cast<u64>(equalMask(block.low, needle))
+                       | (static_cast<u64>(equalMask(block.high, needle)) << 32U);
+            }
+
+            // Shuffles work inside 128-bit lanes, so every table is duplicated in both lanes.
+            ISL_TARGET_AVX2 static auto broadcastTable(const std::array<u8, 16> &table) noexcept
+                -> Vector
+            {
+                const auto *row_pointer = reinterpret_cast<const __m128i *>(table.data());// NOLINT
+                const auto row = _mm_loadu_si128(row_pointer);
+
+                return _mm256_broadcastsi128_si256(row);
+            }
+
+            ISL_TARGET_AVX2 static auto
+                setMask(const Vector block, const SetTables &tables) noexcept -> Mask
+            {
+                const auto nibble_mask = _mm256_set1_epi8(0x0F);
+                const auto bit_table = _mm256_setr_epi8(
+                    1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32,
+                    64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+
+                const auto low_nibbles = _mm256_and_si256(block, nibble_mask);
+                const auto high_nibbles =
+                    _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble_mask);
+
+                const auto low_rows = _mm256_shuffle_epi8(tables.lowRows, low_nibbles);
+                const auto high_rows = _mm256_shuffle_epi8(tables.highRows, low_nibbles);
+                const auto is_high = _mm256_cmpgt_epi8(high_nibbles, _mm256_set1_epi8(7));
+                const auto rows = _mm256_blendv_epi8(low_rows, high_rows, is_high);
+
+                const auto bits = _mm256_shuffle_epi8(bit_table, high_nibbles);
+                const auto hits = _mm256_cmpeq_epi8(_mm256_and_si256(rows, bits), bits);
+
+                return static_cast<Mask>(_mm256_movemask_epi8(hits));
+            }
+
+            ISL_TARGET_AVX2 static auto
+                setMask64(const Block64 &block, const SetTables &tables) noexcept -> u64
+            {
+                return static_cast<u64>(setMask(block.low, tables))
+                       | (static_cast<u64>(setMask(block.high, tables)) << 32U);
+            }
+        };
+
+        struct Avx2Kernels
+        {
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                findByte(const char *data, const std::size_t size, const char chr) noexcept
+                -> std::size_t
+            {
+                // strings shorter than AVX2 vector still fit into SSE2 vector
+                if (size < Avx2::width) {
+                    return findByteKernel<Sse2>(data, size, chr);
+                }
+
+                return findByteKernel<Avx2>(data, size, chr);
+            }
+
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                findLastByte(const char *data, const std::size_t size, const char chr) noexcept
+                -> std::size_t
+            {
+                if (size < Avx2::width) {
+                    return findLastByteKernel<Sse2>(data, size, chr);
+                }
+
+                return findLastByteKernel<Avx2>(data, size, chr);
+            }
+
+            template<bool InSet>
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                findFirstOf(const char *data, const std::size_t size, const ByteSet &set) noexcept
+                -> std::size_t
+            {
+                return findFirstOfKernel<Avx2, InSet>(data, size, set);
+            }
+
+            template<bool InSet>
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                findLastOf(const char *data, const std::size_t size, const ByteSet &set) noexcept
+                -> std::size_t
+            {
+                return findLastOfKernel<Avx2, InSet>(data, size, set);
+            }
+
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto findSubstring(
+                const char *data, const std::size_t size, const char *substring,
+                const std::size_t substring_size) noexcept -> std::size_t
+            {
+                if (size - substring_size + 1 < Avx2::width) {
+                    return findSubstringKernel<Sse2>(data, size, substring, substring_size);
+                }
+
+                return findSubstringKernel<Avx2>(data, size, substring, substring_size);
+            }
+
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                findMismatch(const char *lhs, const char *rhs, const std::size_t size) noexcept
+                -> std::size_t
+            {
+                if (size < Avx2::width) {
+                    return findMismatchKernel<Sse2>(lhs, rhs, size);
+                }
+
+                return findMismatchKernel<Avx2>(lhs, rhs, size);
+            }
+
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                equalMask64(const char *data, const std::size_t size, const char chr) noexcept
+                -> u64
+            {
+                if (size < 64) {
+                    return equalMask64Scalar(data, size, chr);
+                }
+
+                return Avx2::equalMask64(Avx2::load64(data), Avx2::broadcast(chr));
+            }
+
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                setMask64(const char *data, const std::size_t size, const ByteSet &set) noexcept
+                -> u64
+            {
+                if (size < 64) {
+                    return setMask64Scalar(data, size, set);
+                }
+
+                return Avx2::setMask64(Avx2::load64(data), Avx2::SetTables{set});
+            }
+
+            template<bool QuoteAware>
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto findRangeEnd(
+                const char *data, const std::size_t size,
+                const RangeDelimiters &delimiters) noexcept -> std::size_t
+            {
+                return findRangeEndKernel<Avx2, QuoteAware>(data, size, delimiters);
+            }
+        };
+#elif defined(ISL_SIMD_NEON)
+        struct Neon
+        {
+            using Vector = uint8x16_t;
+            using Mask = u64;
+
+            static constexpr std::size_t width = 16;
+            // NEON has no movemask, narrowing shift packs every byte into 4 bits instead
+            static constexpr std::size_t bitsPerLane = 4;
+            static constexpr Mask fullMask = 0x8888'8888'8888'8888ULL;
+
+            struct SetTables
+            {
+                Vector lowRows;
+                Vector highRows;
+
+                explicit SetTables(const ByteSet &set) noexcept
+                  : lowRows{vld1q_u8(set.getLowRows().data())}
+                  , highRows{vld1q_u8(set.getHighRows().data())}
+                {}
+            };
+
+            ISL_INLINE static auto load(const char *data) noexcept -> Vector
+            {
+                return vld1q_u8(reinterpret_cast<const u8 *>(data));// NOLINT
+            }
+
+            ISL_INLINE static auto broadcast(const char chr) noexcept -> Vector
+            {
+                return vdupq_n_u8(static_cast<u8>(chr));
+            }
+
+            ISL_INLINE static auto toMask(const Vector bytes) noexcept -> Mask
+            {
+                const auto narrowed = vshrn_n_u16(vreinterpretq_u16_u8(bytes), 4);
+                return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0) & fullMask;
+            }
+
+            ISL_INLINE static auto equalMask(const Vector lhs, const Vector rhs) noexcept -> Mask
+            {
+                return toMask(vceqq_u8(lhs, rhs));
+            }
+
+            using Block64 = uint8x16x4_t;
+
+            ISL_INLINE static auto load64(const char *data) noexcept -> Block64
+            {
+                return {{load(data), load(data + 16), load(data + 32), load(data + 48)}};
+            }
+
+            // Every byte keeps its own bit of the mask, pairwise additions gather the bits of
+            // 64 bytes into one 64-bit value.
+            ISL_INLINE static auto toMask64(const uint8x16x4_t &bytes) noexcept -> u64
+            {
+                static constexpr auto bit_table = std::array<u8, 16>{
+                    1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+
+                const auto bits = vld1q_u8(bit_table.data());
+                const auto first = vandq_u8(bytes.val[0], bits);
+                const auto second = vandq_u8(bytes.val[1], bits);
+                const auto third = vandq_u8(bytes.val[2], bits);
+                const auto fourth = vandq_u8(bytes.val[3], bits);
+
+                auto sum = vpaddq_u8(vpaddq_u8(first, second), vpaddq_u8(third, fourth));
+                sum = vpaddq_u8(sum, sum);
+
+                return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+            }
+
+            ISL_INLINE static auto equalMask64(const Block64 &block, const Vector needle) noexcept
+                -> u64
+            {
+                return toMask64({{
+                    vceqq_u8(block.val[0], needle),
+                    vceqq_u8(block.val[1], needle),
+                    vceqq_u8(block.val[2], needle),
+                    vceqq_u8(block.val[3], needle),
+                }});
+            }
+
+            ISL_INLINE static auto setMask(const Vector block, const SetTables &tables) noexcept
+                -> Mask
+            {
+                return toMask(setBytes(block, tables));
+            }
+
+            ISL_INLINE static auto setMask64(const Block64 &block, const SetTables &tables) noexcept
+                -> u64
+            {
+                return toMask64({{
+                    setBytes(block.val[0], tables),
+                    setBytes(block.val[1], tables),
+                    setBytes(block.val[2], tables),
+                    setBytes(block.val[3], tables),
+                }});
+            }
+
+            // Returns vector with all bits set in bytes of the set.
+            ISL_INLINE static auto setBytes(const Vector block, const SetTables &tables) noexcept
+                -> Vector
+            {
+                static constexpr auto bit_table = std::array<u8, 16>{
+                    1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+
+                const auto low_nibbles = vandq_u8(block, vdupq_n_u8(0x0F));
+                const auto high_nibbles = vshrq_n_u8(block, 4);
+
+                const auto low_rows = vqtbl1q_u8(tables.lowRows, low_nibbles);
+                const auto high_rows = vqtbl1q_u8(tables.highRows, low_nibbles);
+                const auto is_high = vcgtq_u8(high_nibbles, vdupq_n_u8(7));
+                const auto rows = vbslq_u8(is_high, high_rows, low_rows);
+
+                const auto bits = vqtbl1q_u8(vld1q_u8(bit_table.data()), high_nibbles);
+                return vtstq_u8(rows, bits);
+            }
+        };
+#endif
+
+        struct KernelTable
+        {
+            std::size_t (*findByte)(const char *, std::size_t, char) noexcept;
+            std::size_t (*findLastByte)(const char *, std::size_t, char) noexcept;
+            std::size_t (*findFirstOf)(const char *, std::size_t, const ByteSet &) noexcept;
+            std::size_t (*findFirstNotOf)(const char *, std::size_t, const ByteSet &) noexcept;
+            std::size_t (*findLastOf)(const char *, std::size_t, const ByteSet &) noexcept;
+            std::size_t (*findLastNotOf)(const char *, std::size_t, const ByteSet &) noexcept;
+            std::size_t (*findSubstring)(
+                const char *, std::size_t, const char *, std::size_t) noexcept;
+            std::size_t (*findMismatch)(const char *, const char *, std::size_t) noexcept;
+            u64 (*equalMask64)(const char *, std::size_t, char) noexcept;
+            u64 (*setMask64)(const char *, std::size_t, const ByteSet &) noexcept;
+            std::size_t (*findRangeEnd)(
+                const char *, std::size_t, const RangeDelimiters &) noexcept;
+            std::size_t (*findQuotedRangeEnd)(
+                const char *, std::size_t, const RangeDelimiters &) noexcept;
+        };
+
+        template<typename ByteKernels, typename SetKernels>
+        constexpr auto makeKernelTable() noexcept -> KernelTable
+        {
+            return {
+                .findByte = &ByteKernels::findByte,
+                .findLastByte = &ByteKernels::findLastByte,
+                .findFirstOf = &SetKernels::template findFirstOf<true>,
+                .findFirstNotOf = &SetKernels::template findFirstOf<false>,
+                .findLastOf = &SetKernels::template findLastOf<true>,
+                .findLastNotOf = &SetKernels::template findLastOf<false>,
+                .findSubstring = &ByteKernels::findSubstring,
+                .findMismatch = &ByteKernels::findMismatch,
+                .equalMask64 = &ByteKernels::equalMask64,
+                .setMask64 = &SetKernels::setMask64,
+                .findRangeEnd = &ByteKernels::template findRangeEnd<false>,
+                .findQuotedRangeEnd = &ByteKernels::template findRangeEnd<true>,
+            };
+        }
+
+        auto detectKernels() noexcept -> KernelTable
+        {
+#if defined(ISL_SIMD_X86)
+            if (hasAvx2()) {
+                return makeKernelTable<Avx2Kernels, Avx2Kernels>();
+            }
+
+            // without SSSE3 shuffles bytes can not be tested against a set in vector registers
+            return makeKernelTable<Kernels<Sse2>, Scalar>();
+#elif defined(ISL_SIMD_NEON)
+            return makeKernelTable<Kernels<Neon>, Kernels<Neon>>();
+#else
+            return makeKernelTable<Scalar, Scalar>();
+#endif
+        }
+
+        auto getKernels() noexcept -> KernelTable &
+        {
+            static auto kernels = detectKernels();
+            return kernels;
+        }
+    }// namespace
+
+    ISL_SIMD_KERNELS_END
+
+    auto selectKernels(const KernelSet kernel_set) noexcept -> bool
+    {
+        switch (kernel_set) {
+        case KernelSet::DETECTED:
+            getKernels() = detectKernels();
+            return true;
+
+#if defined(ISL_SIMD_X86)
+        case KernelSet::AVX2:
+            if (!hasAvx2()) {
+                return false;
+            }
+
+            getKernels() = makeKernelTable<Avx2Kernels, Avx2Kernels>();
+            return true;
+
+        case KernelSet::SSE2:
+            getKernels() = makeKernelTable<Kernels<Sse2>, Scalar>();
+            return true;
+#elif defined(ISL_SIMD_NEON)
+        case KernelSet::NEON:
+            getKernels() = makeKernelTable<Kernels<Neon>, Kernels<Neon>>();
+            return true;
+#endif
+
+        case KernelSet::SCALAR:
+            getKernels() = makeKernelTable<Scalar, Scalar>();
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    auto findByte(const char *data, const std::size_t size, const char chr) noexcept -> std::size_t
+    {
+        return getKernels().findByte(data, size, chr);
+    }
+
+    auto findLastByte(const char *data, const std::size_t size, const char chr) noexcept
+        -> std::size_t
+    {
+        return getKernels().findLastByte(data, size, chr);
+    }
+
+    auto findFirstOf(const char *data, const std::size_t size, const ByteSet &set) noexcept
+        -> std::size_t
+    {
+        return getKernels().findFirstOf(data, size, set);
+    }
+
+    auto findFirstNotOf(const char *data, const std::size_t size, const ByteSet &set) noexcept
+        -> std::size_t
+    {
+        return getKernels().findFirstNotOf(data, size, set);
+    }
+
+    auto findLastOf(const char *data, const std::size_t size, const ByteSet &set) noexcept
+        -> std::size_t
+    {
+        return getKernels().findLastOf(data, size, set);
+    }
+
+    auto findLastNotOf(const char *data, const std::size_t size, const ByteSet &set) noexcept
+        -> std::size_t
+    {
+        return getKernels().findLastNotOf(data, size, set);
+    }
+
+    auto findSubstring(
+        const char *data, const std::size_t size, const char *substring,
+        const std::size_t substring_size) noexcept -> std::size_t
+    {
+        if (substring_size == 0) {
+            return 0;
+        }
+
+        if (substring_size > size) {
+            return npos;
+        }
+
+        if (substring_size == 1) {
+            return findByte(data, size, substring[0]);
+        }
+
+        return getKernels().findSubstring(data, size, substring, substring_size);
+    }
+
+    auto findMismatch(const char *lhs, const char *rhs, const std::size_t size) noexcept
+        -> std::size_t
+    {
+        return getKernels().findMismatch(lhs, rhs, size);
+    }
+
+    auto findRangeEnd(
+        const char *data, const std::size_t size, const char open, const char close) noexcept
+        -> std::size_t
+    {
+        return getKernels().findRangeEnd(
+            data, size, RangeDelimiters{.open = open, .close = close, .quote = {}, .escape = {}});
+    }
+
+    auto findQuotedRangeEnd(
+        const char *data, const std::size_t size, const RangeDelimiters &delimiters) noexcept
+        -> std::size_t
+    {
+        return getKernels().findQuotedRangeEnd(data, size, delimiters);
+    }
+
+    auto equalMask64(const char *data, const std::size_t size, const char chr) noexcept -> u64
+    {
+        return getKernels().equalMask64(data, std::min<std::size_t>(size, 64), chr);
+    }
+
+    auto setMask64(const char *data, const std::size_t size, const ByteSet &set) noexcept -> u64
+    {
+        return getKernels().setMask64(data, std::min<std::size_t>(size, 64), set);
+    }
+}// namespace isl::detail::string_search
@@ -0,0 +1,87 @@
+#include <isl/thread/hazard_pointer.hpp>
+
+namespace isl::thread
+{
+    namespace
+    {
+        std::atomic<HazardRecord *> HazardRecordsHead{nullptr}; // NOLINT
+
+        class LocalHazardRecordHolder
+        {
+        private:
+            HazardRecord *record{detail::acquireHazardRecord()};
+
+        public:
+            LocalHazardRecordHolder() = default;
+
+            LocalHazardRecordHolder(const LocalHazardRecordHolder &) = delete;
+            LocalHazardRecordHolder(LocalHazardRecordHolder &&) = delete;
+
+            ~LocalHazardRecordHolder()
+            {
+                detail::releaseHazardRecord(record);
+            }
+
+            auto operator=(const LocalHazardRecordHolder &) -> LocalHazardRecordHolder & = delete;
+            auto operator=(LocalHazardRecordHolder &&) -> LocalHazardRecordHolder & = delete;
+
+            [[nodiscard]] auto get() const noexcept -> HazardRecord &
+            {
+                return *record;
+            }
+        };
+    } // namespace
+
+    auto detail::localHazardRecord() -> HazardRecord &
+    {
+        thread_local auto holder = LocalHazardRecordHolder{};
+        return holder.get();
+    }
+
+    auto detail::acquireHazardRecord() -> HazardRecord *
+    {
+        for (auto *record = HazardRecordsHead.load(std::memory_order_acquire); record != nullptr;
+             record = record->next) {
+            auto expected = false;
+
+            if (record->active.compare_exchange_strong(
+                    expected, true, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return record;
+            }
+        }
+
+        auto *record = ::new HazardRecord{};
+        record->active.store(true, std::memory_order_relaxed);
+        record->next = HazardRecordsHead.load(std::memory_order_relaxed);
+
+        while (!HazardRecordsHead.compare_exchange_weak(
+            record->next, record, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+
+        return record;
+    }
+
+    auto detail::releaseHazardRecord(HazardRecord *record) noexcept -> void
+    {
+        for (auto &slot : record->slots) {
+            slot.store(nullptr, std::memory_order_release);
+        }
+
+        record->usedSlots = 0;
+        record->active.store(false, std::memory_order_release);
+    }
+
+    auto isHazardous(const void *pointer) noexcept -> bool
+    {
+        for (const auto *record = HazardRecordsHead.load(std::memory_order_acquire);
+             record != nullptr; record = record->next) {
+            for (const auto &slot : record->slots) {
+                if (slot.load(std::memory_order_seq_cst) == pointer) {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+} // namespace isl::thread
@@ -0,0 +1,1272 @@
+#include <bit>
+#include <cstring>
+#include <isl/detail/simd_dispatch.hpp>
+#include <isl/detail/unicode.hpp>
+#include <isl/utf8.hpp>
+
+namespace isl::detail::unicode
+{
+    ISL_SIMD_KERNELS_BEGIN
+
+    namespace
+    {
+        constexpr auto HighBits64 = u64{0x8080'8080'8080'8080ULL};
+
+        auto loadWord(const char *data) noexcept -> u64
+        {
+            auto word = u64{};
+            std::memcpy(&word, data, sizeof(word));
+            return word;
+        }
+
+        // Words of ASCII characters are skipped at once, other characters are checked one by
+        // one.
+        auto findFirstInvalidScalar(const char *data, std::size_t first, const std::size_t size)
+            noexcept -> std::size_t
+        {
+            while (first + sizeof(u64) <= size) {
+                if ((loadWord(data + first) & HighBits64) == 0) {
+                    first += sizeof(u64);
+                    continue;
+                }
+
+                const auto sequence_size =
+                    utf8::detail::validSequenceSize(data + first, size - first);
+
+                if (sequence_size == 0) {
+                    return first;
+                }
+
+                first += sequence_size;
+            }
+
+            return utf8::detail::findFirstInvalidScalar(data, first, size);
+        }
+
+        auto countCodePointsScalar(const char *data, const std::size_t size) noexcept
+            -> std::size_t
+        {
+            auto result = std::size_t{};
+            auto index = std::size_t{};
+
+            for (; index + sizeof(u64) <= size; index += sizeof(u64)) {
+                const auto word = loadWord(data + index);
+                // continuation bytes have the highest bit set and the next one cleared
+                const auto continuations = word & ~(word << 1U) & HighBits64;
+
+                result += sizeof(u64) - static_cast<std::size_t>(std::popcount(continuations));
+            }
+
+            return result + utf8::detail::countCodePointsScalar(data + index, size - index);
+        }
+
+        // Every lead byte takes one code unit, four byte sequences take two of them.
+        auto utf16SizeScalar(const char *data, const std::size_t size) noexcept -> std::size_t
+        {
+            auto result = std::size_t{};
+            auto index = std::size_t{};
+
+            for (; index + sizeof(u64) <= size; index += sizeof(u64)) {
+                const auto word = loadWord(data + index);
+                const auto continuations = word & ~(word << 1U) & HighBits64;
+                const auto four_byte_leads =
+                    word & (word << 1U) & (word << 2U) & (word << 3U) & HighBits64;
+
+                result += sizeof(u64) - static_cast<std::size_t>(std::popcount(continuations))
+                          + static_cast<std::size_t>(std::popcount(four_byte_leads));
+            }
+
+            return result + utf8::detail::utf16SizeScalar(data + index, size - index);
+        }
+
+        // Returns number of written characters, position moves to the end of the sequence.
+        template<typename CharT>
+        ISL_INLINE auto
+            decodeSequence(const char *data, std::size_t &position, CharT *buffer) noexcept
+            -> std::size_t
+        {
+            const auto sequence_size = std::max<u16>(utf8::size(data[position]), 1);
+            const auto chr = utf8::detail::decodeCodePoint(data + position, sequence_size);
+
+            position += sequence_size;
+            return utf8::detail::writeCodePoint(buffer, chr);
+        }
+
+        // Words of ASCII characters are copied at once, other characters are decoded one by
+        // one.
+        template<typename CharT>
+        auto decodeScalar(const char *data, const std::size_t size, CharT *buffer) noexcept
+            -> std::size_t
+        {
+            auto position = std::size_t{};
+            auto written = std::size_t{};
+
+            while (position + sizeof(u64) <= size) {
+                if ((loadWord(data + position) & HighBits64) != 0) {
+                    written += decodeSequence(data, position, buffer + written);
+                    continue;
+                }
+
+                for (std::size_t i = 0; i != sizeof(u64); ++i) {
+                    buffer[written + i] = static_cast<CharT>(data[position + i]);
+                }
+
+                position += sizeof(u64);
+                written += sizeof(u64);
+            }
+
+            return written
+                   + utf8::detail::decodeScalar(data + position, size - position, buffer + written);
+        }
+
+        // Index of the first byte of a sequence which may contain byte at the given position.
+        // Sequences have at most three continuation bytes, if there are more of them the byte at
+        // position is ill-formed by itself.
+        auto sequenceStart(const char *data, const std::size_t position) noexcept -> std::size_t
+        {
+            for (std::size_t back = 1; back <= 3 && back <= position; ++back) {
+                if (!utf8::isTrailingCharacter(data[position - back])) {
+                    return position - back;
+                }
+            }
+
+            return position;
+        }
+
+        struct Scalar
+        {
+            static auto findFirstInvalid(const char *data, const std::size_t size) noexcept
+                -> std::size_t
+            {
+                return findFirstInvalidScalar(data, 0, size);
+            }
+
+            static auto countCodePoints(const char *data, const std::size_t size) noexcept
+                -> std::size_t
+            {
+                return countCodePointsScalar(data, size);
+            }
+
+            static auto utf16Size(const char *data, const std::size_t size) noexcept
+                -> std::size_t
+            {
+                return utf16SizeScalar(data, size);
+            }
+
+            template<typename CharT>
+            static auto decode(const char *data, const std::size_t size, CharT *buffer) noexcept
+                -> std::size_t
+            {
+                return decodeScalar(data, size, buffer);
+            }
+
+            template<typename CharT>
+            static auto encode(const CharT *data, const std::size_t size, char *buffer) noexcept
+                -> std::size_t
+            {
+                return utf8::detail::encodeScalar(data, size, buffer);
+            }
+        };
+
+        // Classes of errors in two consecutive bytes from "Validating UTF-8 In Less Than One
+        // Instruction Per Byte" by J. Keiser and D. Lemire. Every table maps a nibble to classes
+        // it may belong to, the pair of bytes is ill-formed if all three nibbles share a class.
+        // NOLINTBEGIN
+        constexpr u8 TooShort = 1U << 0U; // lead byte followed by lead or ASCII byte
+        constexpr u8 TooLong = 1U << 1U; // ASCII byte followed by continuation byte
+        constexpr u8 Overlong3 = 1U << 2U; // 11100000 100xxxxx
+        constexpr u8 TooLarge = 1U << 3U; // above U+10FFFF
+        constexpr u8 Surrogate = 1U << 4U; // 11101101 101xxxxx
+        constexpr u8 Overlong2 = 1U << 5U; // 1100000x 10xxxxxx
+        constexpr u8 TooLarge1000 = 1U << 6U; // above U+10FFFF with 1000xxxx second byte
+        constexpr u8 Overlong4 = 1U << 6U; // 11110000 1000xxxx
+        constexpr u8 TwoContinuations = 1U << 7U; // continuation byte followed by another one
+        constexpr u8 Carry = TooShort | TooLong | TwoContinuations;
+
+        constexpr auto FirstHighNibbleClasses = std::array<u8, 16>{
+            TooLong,
+            TooLong,
+            TooLong,
+            TooLong,
+            TooLong,
+            TooLong,
+            TooLong,
+            TooLong,
+            TwoContinuations,
+            TwoContinuations,
+            TwoContinuations,
+            TwoContinuations,
+            TooShort | Overlong2,
+            TooShort,
+            TooShort | Overlong3 | Surrogate,
+            TooShort | TooLarge | TooLarge1000 | Overlong4,
+        };
+
+        constexpr auto FirstLowNibbleClasses = std::array<u8, 16>{
+            Carry | Overlong3 | Overlong2 | Overlong4,
+            Carry | Overlong2,
+            Carry,
+            Carry,
+            Carry | TooLarge,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000 | Surrogate,
+            Carry | TooLarge | TooLarge1000,
+            Carry | TooLarge | TooLarge1000,
+        };
+
+        constexpr auto SecondHighNibbleClasses = std::array<u8, 16>{
+            TooShort,
+            TooShort,
+            TooShort,
+            TooShort,
+            TooShort,
+            TooShort,
+            TooShort,
+            TooShort,
+            TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge1000 | Overlong4,
+            TooLong | Overlong2 | TwoContinuations | Overlong3 | TooLarge,
+            TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge,
+            TooLong | Overlong2 | TwoContinuations | Surrogate | TooLarge,
+            TooShort,
+            TooShort,
+            TooShort,
+            TooShort,
+        };
+
+        // Byte at the end of a vector starts a sequence which does not fit into the vector if it
+        // is greater than the limit.
+        constexpr auto IncompleteLimits = std::array<u8, 32>{
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+            0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF,
+        };
+        // NOLINTEND
+
+        // Fills errors with non-zero bytes where input is ill-formed, previous vector is required
+        // for sequences which start in it. AVX2 vectors can't be returned from a function without
+        // the AVX2 target, so the result is written through the reference.
+        template<typename Isa>
+        ISL_INLINE auto utf8Errors(
+            const typename Isa::Vector &input, const typename Isa::Vector &previous,
+            typename Isa::Vector &errors) noexcept -> void
+        {
+            const auto previous1 = Isa::template shiftIn<1>(input, previous);
+
+            const auto first_high =
+                Isa::lookup(FirstHighNibbleClasses, Isa::highNibbles(previous1));
+            const auto first_low = Isa::lookup(FirstLowNibbleClasses, Isa::lowNibbles(previous1));
+            const auto second_high = Isa::lookup(SecondHighNibbleClasses, Isa::highNibbles(input));
+            const auto special_cases =
+                Isa::bitAnd(Isa::bitAnd(first_high, first_low), second_high);
+
+            // Third and fourth bytes of sequences are continuation bytes, the tables have marked
+            // them as two continuations in a row.
+            const auto third_bytes = Isa::subtractSaturated(
+                Isa::template shiftIn<2>(input, previous), Isa::broadcast(0xE0 - 0x80));
+            const auto fourth_bytes = Isa::subtractSaturated(
+                Isa::template shiftIn<3>(input, previous), Isa::broadcast(0xF0 - 0x80));
+            const auto must_continue =
+                Isa::bitAnd(Isa::bitOr(third_bytes, fourth_bytes), Isa::broadcast(0x80));
+
+            errors = Isa::bitXor(must_continue, special_cases);
+        }
+
+        template<typename Isa>
+        ISL_INLINE auto isIncomplete(const typename Isa::Vector &last) noexcept -> bool
+        {
+            const auto *limits = reinterpret_cast<const char *>(IncompleteLimits.data());// NOLINT
+            const auto limit = Isa::load(limits + IncompleteLimits.size() - Isa::width);
+
+            return Isa::anySet(Isa::subtractSaturated(last, limit));
+        }
+
+        // Blocks of ASCII characters are only checked to not continue the previous block. The
+        // scalar loop finds position of the first error inside a broken block and checks the
+        // tail, it starts from the sequence which crosses the block boundary.
+        template<typename Isa>
+        ISL_INLINE auto findFirstInvalidKernel(const char *data, const std::size_t size) noexcept
+            -> std::size_t
+        {
+            auto previous = Isa::broadcast(0);
+            auto position = std::size_t{};
+
+            for (; position + 64 <= size; position += 64) {
+                const auto block = Isa::load64(data + position);
+
+                if (Isa::isAscii(block)) {
+                    if (isIncomplete<Isa>(previous)) {
+                        break;
+                    }
+                } else if (Isa::hasErrors(block, previous)) {
+                    break;
+                }
+
+                previous = Isa::lastVector(block);
+            }
+
+            return findFirstInvalidScalar(data, sequenceStart(data, position), size);
+        }
+
+        // Without byte shuffles blocks of ASCII characters are skipped and others are checked by
+        // the scalar loop, which stops at the first sequence that ends after the block.
+        template<typename Isa>
+        ISL_INLINE auto
+            findFirstInvalidAsciiKernel(const char *data, const std::size_t size) noexcept
+            -> std::size_t
+        {
+            auto position = std::size_t{};
+
+            while (position + 64 <= size) {
+                if (Isa::isAscii(Isa::load64(data + position))) {
+                    position += 64;
+                    continue;
+                }
+
+                const auto block_end = position + 64;
+
+                while (position < block_end) {
+                    const auto sequence_size =
+                        utf8::detail::validSequenceSize(data + position, size - position);
+
+                    if (sequence_size == 0) {
+                        return position;
+                    }
+
+                    position += sequence_size;
+                }
+            }
+
+            return findFirstInvalidScalar(data, position, size);
+        }
+
+        template<typename Isa>
+        ISL_INLINE auto countCodePointsKernel(const char *data, const std::size_t size) noexcept
+            -> std::size_t
+        {
+            auto result = std::size_t{};
+            auto position = std::size_t{};
+
+            for (; position + 64 <= size; position += 64) {
+                result += Isa::countLeadBytes(Isa::load64(data + position));
+            }
+
+            return result + countCodePointsScalar(data + position, size - position);
+        }
+
+        template<typename Isa>
+        ISL_INLINE auto utf16SizeKernel(const char *data, const std::size_t size) noexcept
+            -> std::size_t
+        {
+            auto result = std::size_t{};
+            auto position = std::size_t{};
+
+            for (; position + 64 <= size; position += 64) {
+                const auto block = Isa::load64(data + position);
+                result += Isa::countLeadBytes(block) + Isa::countFourByteLeads(block);
+            }
+
+            return result + utf16SizeScalar(data + position, size - position);
+        }
+
+        // Blocks of ASCII characters are widened. Blocks without four byte sequences are decoded
+        // in 16-bit lanes at every position as if it starts a sequence, then values at lead
+        // bytes are written out. Sequences which start at the end of a block are decoded from two
+        // bytes after it. Other blocks are decoded sequence by sequence.
+        template<typename Isa, typename CharT>
+        ISL_INLINE auto
+            decodeKernel(const char *data, const std::size_t size, CharT *buffer) noexcept
+            -> std::size_t
+        {
+            auto position = std::size_t{};
+            auto written = std::size_t{};
+
+            while (position + Isa::width + 2 <= size) {
+                const auto block = Isa::load(data + position);
+                const auto block_end = position + Isa::width;
+
+                if (Isa::isAscii(block)) {
+                    Isa::widen(block, buffer + written);
+                    position = block_end;
+                    written += Isa::width;
+                    continue;
+                }
+
+                if (Isa::fourByteLeadMask(block) != 0) {
+                    while (position < block_end) {
+                        written += decodeSequence(data, position, buffer + written);
+                    }
+
+                    continue;
+                }
+
+                std::array<u16, Isa::width> values;// NOLINT
+                Isa::decodeBasicPlane(data + position, values.data());
+
+                for (auto leads = Isa::leadMask(block); leads != 0; leads &= leads - 1) {
+                    const auto index = static_cast<std::size_t>(std::countr_zero(leads));
+                    buffer[written++] = static_cast<CharT>(values[index]);
+                }
+
+                position = block_end;
+
+                while (position != size && utf8::isTrailingCharacter(data[position])) {
+                    ++position;
+                }
+            }
+
+            return written + decodeScalar(data + position, size - position, buffer + written);
+        }
+
+        // Bits which are set only in code units not less than the limit, a power of two.
+        template<typename CharT>
+        constexpr auto bitsNotBelow(const u32 limit) noexcept -> u32
+        {
+            if constexpr (sizeof(CharT) == 2) {
+                const auto lane = ~(limit - 1) & 0xFFFFU;
+                return lane | (lane << 16U);
+            } else {
+                return ~(limit - 1);
+            }
+        }
+
+        // Blocks of ASCII code points are narrowed. Code points of blocks below U+0800 take one
+        // or two bytes, both bytes are always written and the output moves by the size of the
+        // sequence. The extra byte is overwritten by the next sequence, so the last block is
+        // encoded by the scalar loop. Other blocks are encoded code point by code point.
+        template<typename Isa, typename CharT>
+        ISL_INLINE auto
+            encodeKernel(const CharT *data, const std::size_t size, char *buffer) noexcept
+            -> std::size_t
+        {
+            auto position = std::size_t{};
+            auto written = std::size_t{};
+
+            while (position + Isa::width < size) {
+                const auto units = Isa::orCodeUnits(data + position);
+                auto block_end = position + Isa::width;
+
+                if (!Isa::anyBits(units, bitsNotBelow<CharT>(0x80))) {
+                    Isa::narrow(data + position, buffer + written);
+                    position = block_end;
+                    written += Isa::width;
+                    continue;
+                }
+
+                if (!Isa::anyBits(units, bitsNotBelow<CharT>(0x800))) {
+                    for (; position != block_end; ++position) {
+                        const auto chr = static_cast<u32>(data[position]);
+                        const auto is_two_bytes = chr > 0x7F;
+
+                        const auto first = is_two_bytes ? 0xC0U | (chr >> 6U) : chr;
+
+                        buffer[written] = static_cast<char>(first);
+                        buffer[written + 1] = static_cast<char>(0x80U | (chr & 0x3FU));
+                        written += 1 + static_cast<std::size_t>(is_two_bytes);
+                    }
+
+                    continue;
+                }
+
+                // surrogate pair may cross the end of the block
+                if constexpr (sizeof(CharT) == 2) {
+                    block_end += static_cast<std::size_t>(
+                        utf8::detail::isHighSurrogate(data[block_end - 1]));
+                }
+
+                written += utf8::detail::encodeScalar(
+                    data + position, block_end - position, buffer + written);
+                position = block_end;
+            }
+
+            return written
+                   + utf8::detail::encodeScalar(data + position, size - position, buffer + written);
+        }
+
+        template<typename Isa>
+        struct Kernels
+        {
+            static auto findFirstInvalid(const char *data, const std::size_t size) noexcept
+                -> std::size_t
+            {
+                if constexpr (Isa::hasShuffle) {
+                    return findFirstInvalidKernel<Isa>(data, size);
+                } else {
+                    return findFirstInvalidAsciiKernel<Isa>(data, size);
+                }
+            }
+
+            static auto countCodePoints(const char *data, const std::size_t size) noexcept
+                -> std::size_t
+            {
+                return countCodePointsKernel<Isa>(data, size);
+            }
+
+            static auto utf16Size(const char *data, const std::size_t size) noexcept
+                -> std::size_t
+            {
+                return utf16SizeKernel<Isa>(data, size);
+            }
+
+            template<typename CharT>
+            static auto decode(const char *data, const std::size_t size, CharT *buffer) noexcept
+                -> std::size_t
+            {
+                return decodeKernel<Isa>(data, size, buffer);
+            }
+
+            template<typename CharT>
+            static auto encode(const CharT *data, const std::size_t size, char *buffer) noexcept
+                -> std::size_t
+            {
+                return encodeKernel<Isa>(data, size, buffer);
+            }
+        };
+
+#if defined(ISL_SIMD_X86)
+        struct Sse2
+        {
+            using Vector = __m128i;
+
+            static constexpr std::size_t width = 16;
+            static constexpr bool hasShuffle = false;
+
+            struct Block64
+            {
+                Vector first;
+                Vector second;
+                Vector third;
+                Vector fourth;
+            };
+
+            ISL_INLINE static auto load(const char *data) noexcept -> Vector
+            {
+                return _mm_loadu_si128(reinterpret_cast<const Vector *>(data));// NOLINT
+            }
+
+            ISL_INLINE static auto load64(const char *data) noexcept -> Block64
+            {
+                return {load(data), load(data + 16), load(data + 32), load(data + 48)};
+            }
+
+            ISL_INLINE static auto isAscii(const Block64 &block) noexcept -> bool
+            {
+                const auto low = _mm_or_si128(block.first, block.second);
+                const auto high = _mm_or_si128(block.third, block.fourth);
+
+                return _mm_movemask_epi8(_mm_or_si128(low, high)) == 0;
+            }
+
+            // Continuation bytes are the only ones below -64 as signed numbers
+            ISL_INLINE static auto leadMask(const Vector block) noexcept -> u32
+            {
+                return static_cast<u32>(
+                    _mm_movemask_epi8(_mm_cmpgt_epi8(block, _mm_set1_epi8(-65))));
+            }
+
+            ISL_INLINE static auto countLeadBytes(const Block64 &block) noexcept -> std::size_t
+            {
+                const auto mask = static_cast<u64>(leadMask(block.first))
+                                  | (static_cast<u64>(leadMask(block.second)) << 16U)
+                                  | (static_cast<u64>(leadMask(block.third)) << 32U)
+                                  | (static_cast<u64>(leadMask(block.fourth)) << 48U);
+
+                return static_cast<std::size_t>(std::popcount(mask));
+            }
+
+            ISL_INLINE static auto fourByteLeadMask(const Vector block) noexcept -> u32
+            {
+                const auto is_lead = _mm_cmpeq_epi8(_mm_max_epu8(block, _mm_set1_epi8(-16)), block);
+                return static_cast<u32>(_mm_movemask_epi8(is_lead));
+            }
+
+            ISL_INLINE static auto countFourByteLeads(const Block64 &block) noexcept
+                -> std::size_t
+            {
+                const auto mask = static_cast<u64>(fourByteLeadMask(block.first))
+                                  | (static_cast<u64>(fourByteLeadMask(block.second)) << 16U)
+                                  | (static_cast<u64>(fourByteLeadMask(block.third)) << 32U)
+                                  | (static_cast<u64>(fourByteLeadMask(block.fourth)) << 48U);
+
+                return static_cast<std::size_t>(std::popcount(mask));
+            }
+
+            ISL_INLINE static auto isAscii(const Vector block) noexcept -> bool
+            {
+                return _mm_movemask_epi8(block) == 0;
+            }
+
+            template<typename T>
+            ISL_INLINE static auto loadUnits(const T *data) noexcept -> Vector
+            {
+                return _mm_loadu_si128(reinterpret_cast<const Vector *>(data));// NOLINT
+            }
+
+            template<typename T>
+            ISL_INLINE static auto store(T *buffer, const Vector value) noexcept -> void
+            {
+                _mm_storeu_si128(reinterpret_cast<Vector *>(buffer), value);// NOLINT
+            }
+
+            ISL_INLINE static auto widen(const Vector block, char16_t *buffer) noexcept -> void
+            {
+                const auto zero = _mm_setzero_si128();
+
+                store(buffer, _mm_unpacklo_epi8(block, zero));
+                store(buffer + 8, _mm_unpackhi_epi8(block, zero));
+            }
+
+            ISL_INLINE static auto widen(const Vector block, char32_t *buffer) noexcept -> void
+            {
+                const auto zero = _mm_setzero_si128();
+                const auto low = _mm_unpacklo_epi8(block, zero);
+                const auto high = _mm_unpackhi_epi8(block, zero);
+
+                store(buffer, _mm_unpacklo_epi16(low, zero));
+                store(buffer + 4, _mm_unpackhi_epi16(low, zero));
+                store(buffer + 8, _mm_unpacklo_epi16(high, zero));
+                store(buffer + 12, _mm_unpackhi_epi16(high, zero));
+            }
+
+            ISL_INLINE static auto
+                select(const Vector mask, const Vector if_set, const Vector if_clear) noexcept
+                -> Vector
+            {
+                return _mm_or_si128(_mm_and_si128(mask, if_set), _mm_andnot_si128(mask, if_clear));
+            }
+
+            // Code points of sequences of up to three bytes at every position, bytes of the
+            // sequences are given in 16-bit lanes.
+            ISL_INLINE static auto
+                decodeLanes(const Vector first, const Vector second, const Vector third) noexcept
+                -> Vector
+            {
+                const auto six_bits = _mm_set1_epi16(0x3F);
+                const auto lead_two = _mm_slli_epi16(_mm_and_si128(first, _mm_set1_epi16(0x1F)), 6);
+                const auto lead_three =
+                    _mm_slli_epi16(_mm_and_si128(first, _mm_set1_epi16(0x0F)), 12);
+                const auto second_bits = _mm_and_si128(second, six_bits);
+
+                const auto two_bytes = _mm_or_si128(lead_two, second_bits);
+                const auto three_bytes = _mm_or_si128(
+                    _mm_or_si128(lead_three, _mm_slli_epi16(second_bits, 6)),
+                    _mm_and_si128(third, six_bits));
+
+                const auto is_ascii = _mm_cmplt_epi16(first, _mm_set1_epi16(0x80));
+                const auto is_three_bytes = _mm_cmpgt_epi16(first, _mm_set1_epi16(0xDF));
+
+                return select(is_ascii, first, select(is_three_bytes, three_bytes, two_bytes));
+            }
+
+            ISL_INLINE static auto decodeBasicPlane(const char *data, u16 *values) noexcept -> void
+            {
+                const auto zero = _mm_setzero_si128();
+                const auto first = load(data);
+                const auto second = load(data + 1);
+                const auto third = load(data + 2);
+
+                store(
+                    values,
+                    decodeLanes(
+                        _mm_unpacklo_epi8(first, zero), _mm_unpacklo_epi8(second, zero),
+                        _mm_unpacklo_epi8(third, zero)));
+                store(
+                    values + 8,
+                    decodeLanes(
+                        _mm_unpackhi_epi8(first, zero), _mm_unpackhi_epi8(second, zero),
+                        _mm_unpackhi_epi8(third, zero)));
+            }
+
+            template<typename CharT>
+            ISL_INLINE static auto orCodeUnits(const CharT *data) noexcept -> Vector
+            {
+                constexpr auto units_in_vector = sizeof(Vector) / sizeof(CharT);
+                auto result = loadUnits(data);
+
+                for (auto i = units_in_vector; i != width; i += units_in_vector) {
+                    result = _mm_or_si128(result, loadUnits(data + i));
+                }
+
+                return result;
+            }
+
+            ISL_INLINE static auto anyBits(const Vector units, const u32 bits) noexcept -> bool
+            {
+                const auto masked = _mm_and_si128(units, _mm_set1_epi32(static_cast<int>(bits)));
+                return _mm_movemask_epi8(_mm_cmpeq_epi8(masked, _mm_setzero_si128())) != 0xFFFF;
+            }
+
+            ISL_INLINE static auto narrow(const char16_t *data, char *buffer) noexcept -> void
+            {
+                store(buffer, _mm_packus_epi16(loadUnits(data), loadUnits(data + 8)));
+            }
+
+            ISL_INLINE static auto narrow(const char32_t *data, char *buffer) noexcept -> void
+            {
+                const auto low = _mm_packs_epi32(loadUnits(data), loadUnits(data + 4));
+                const auto high = _mm_packs_epi32(loadUnits(data + 8), loadUnits(data + 12));
+
+                store(buffer, _mm_packus_epi16(low, high));
+            }
+        };
+
+        struct Avx2
+        {
+            using Vector = __m256i;
+
+            static constexpr std::size_t width = 32;
+            static constexpr bool hasShuffle = true;
+
+            struct Block64
+            {
+                Vector low;
+                Vector high;
+            };
+
+            ISL_TARGET_AVX2 static auto load(const char *data) noexcept -> Vector
+            {
+                return _mm256_loadu_si256(reinterpret_cast<const Vector *>(data));// NOLINT
+            }
+
+            ISL_TARGET_AVX2 static auto load64(const char *data) noexcept -> Block64
+            {
+                return {load(data), load(data + 32)};
+            }
+
+            ISL_TARGET_AVX2 static auto broadcast(const u8 value) noexcept -> Vector
+            {
+                return _mm256_set1_epi8(static_cast<char>(value));
+            }
+
+            ISL_TARGET_AVX2 static auto bitAnd(const Vector lhs, const Vector rhs) noexcept
+                -> Vector
+            {
+                return _mm256_and_si256(lhs, rhs);
+            }
+
+            ISL_TARGET_AVX2 static auto bitOr(const Vector lhs, const Vector rhs) noexcept
+                -> Vector
+            {
+                return _mm256_or_si256(lhs, rhs);
+            }
+
+            ISL_TARGET_AVX2 static auto bitXor(const Vector lhs, const Vector rhs) noexcept
+                -> Vector
+            {
+                return _mm256_xor_si256(lhs, rhs);
+            }
+
+            ISL_TARGET_AVX2 static auto
+                subtractSaturated(const Vector lhs, const Vector rhs) noexcept -> Vector
+            {
+                return _mm256_subs_epu8(lhs, rhs);
+            }
+
+            ISL_TARGET_AVX2 static auto anySet(const Vector block) noexcept -> bool
+            {
+                return _mm256_testz_si256(block, block) == 0;
+            }
+
+            ISL_TARGET_AVX2 static auto lowNibbles(const Vector block) noexcept -> Vector
+            {
+                return _mm256_and_si256(block, _mm256_set1_epi8(0x0F));
+            }
+
+            ISL_TARGET_AVX2 static auto highNibbles(const Vector block) noexcept -> Vector
+            {
+                return _mm256_and_si256(_mm256_srli_epi16(block, 4), _mm256_set1_epi8(0x0F));
+            }
+
+            // Shuffles work inside 128-bit lanes, so the table is duplicated in both lanes.
+            ISL_TARGET_AVX2 static auto
+                lookup(const std::array<u8, 16> &table, const Vector indices) noexcept -> Vector
+            {
+                const auto *row_pointer = reinterpret_cast<const __m128i *>(table.data());// NOLINT
+                const auto row = _mm256_broadcastsi128_si256(_mm_loadu_si128(row_pointer));
+
+                return _mm256_shuffle_epi8(row, indices);
+            }
+
+            // Input shifted by Count bytes, the first bytes are taken from the end of previous.
+            template<int Count>
+            ISL_TARGET_AVX2 static auto shiftIn(const Vector input, const Vector previous) noexcept
+                -> Vector
+            {
+                const auto lanes = _mm256_permute2x128_si256(previous, input, 0x21);
+                return _mm256_alignr_epi8(input, lanes, 16 - Count);
+            }
+
+            ISL_TARGET_AVX2 static auto isAscii(const Block64 &block) noexcept -> bool
+            {
+                return _mm256_movemask_epi8(_mm256_or_si256(block.low, block.high)) == 0;
+            }
+
+            ISL_TARGET_AVX2 static auto
+                hasErrors(const Block64 &block, const Vector previous) noexcept -> bool
+            {
+                auto low_errors = Vector{};
+                auto high_errors = Vector{};
+                utf8Errors<Avx2>(block.low, previous, low_errors);
+                utf8Errors<Avx2>(block.high, block.low, high_errors);
+
+                return anySet(_mm256_or_si256(low_errors, high_errors));
+            }
+
+            ISL_TARGET_AVX2 static auto lastVector(const Block64 &block) noexcept -> Vector
+            {
+                return block.high;
+            }
+
+            ISL_TARGET_AVX2 static auto leadMask(const Vector block) noexcept -> u32
+            {
+                const auto is_lead = _mm256_cmpgt_epi8(block, _mm256_set1_epi8(-65));
+                return static_cast<u32>(_mm256_movemask_epi8(is_lead));
+            }
+
+            ISL_TARGET_AVX2 static auto countLeadBytes(const Block64 &block) noexcept
+                -> std::size_t
+            {
+                const auto mask = static_cast<u64>(leadMask(block.low))
+                                  | (static_cast<u64>(leadMask(block.high)) << 32U);
+
+                return static_cast<std::size_t>(std::popcount(mask));
+            }
+
+            ISL_TARGET_AVX2 static auto fourByteLeadMask(const Vector block) noexcept -> u32
+            {
+                const auto threshold = _mm256_set1_epi8(-16);
+                const auto is_lead = _mm256_cmpeq_epi8(_mm256_max_epu8(block, threshold), block);
+
+                return static_cast<u32>(_mm256_movemask_epi8(is_lead));
+            }
+
+            ISL_TARGET_AVX2 static auto countFourByteLeads(const Block64 &block) noexcept
+                -> std::size_t
+            {
+                const auto mask = static_cast<u64>(fourByteLeadMask(block.low))
+                                  | (static_cast<u64>(fourByteLeadMask(block.high)) << 32U);
+
+                return static_cast<std::size_t>(std::popcount(mask));
+            }
+
+            ISL_TARGET_AVX2 static auto isAscii(const Vector block) noexcept -> bool
+            {
+                return _mm256_movemask_epi8(block) == 0;
+            }
+
+            template<typename T>
+            ISL_TARGET_AVX2 static auto loadUnits(const T *data) noexcept -> Vector
+            {
+                return _mm256_loadu_si256(reinterpret_cast<const Vector *>(data));// NOLINT
+            }
+
+            template<typename T>
+            ISL_TARGET_AVX2 static auto store(T *buffer, const Vector value) noexcept -> void
+            {
+                _mm256_storeu_si256(reinterpret_cast<Vector *>(buffer), value);// NOLINT
+            }
+
+            ISL_TARGET_AVX2 static auto widen(const Vector block, char16_t *buffer) noexcept
+                -> void
+            {
+                store(buffer, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(block)));
+                store(buffer + 16, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(block, 1)));
+            }
+
+            ISL_TARGET_AVX2 static auto widen(const Vector block, char32_t *buffer) noexcept
+                -> void
+            {
+                const auto low = _mm256_castsi256_si128(block);
+                const auto high = _mm256_extracti128_si256(block, 1);
+
+                store(buffer, _mm256_cvtepu8_epi32(low));
+                store(buffer + 8, _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+                store(buffer + 16, _mm256_cvtepu8_epi32(high));
+                store(buffer + 24, _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+            }
+
+            // Code points of sequences of up to three bytes at every position, bytes of the
+            // sequences are given in 16-bit lanes.
+            ISL_TARGET_AVX2 static auto
+                decodeLanes(const Vector first, const Vector second, const Vector third) noexcept
+                -> Vector
+            {
+                const auto six_bits = _mm256_set1_epi16(0x3F);
+                const auto lead_two =
+                    _mm256_slli_epi16(_mm256_and_si256(first, _mm256_set1_epi16(0x1F)), 6);
+                const auto lead_three =
+                    _mm256_slli_epi16(_mm256_and_si256(first, _mm256_set1_epi16(0x0F)), 12);
+                const auto second_bits = _mm256_and_si256(second, six_bits);
+
+                const auto two_bytes = _mm256_or_si256(lead_two, second_bits);
+                const auto three_bytes = _mm256_or_si256(
+                    _mm256_or_si256(lead_three, _mm256_slli_epi16(second_bits, 6)),
+                    _mm256_and_si256(third, six_bits));
+
+                const auto is_ascii = _mm256_cmpgt_epi16(_mm256_set1_epi16(0x80), first);
+                const auto is_three_bytes = _mm256_cmpgt_epi16(first, _mm256_set1_epi16(0xDF));
+                const auto multibyte = _mm256_blendv_epi8(two_bytes, three_bytes, is_three_bytes);
+
+                return _mm256_blendv_epi8(multibyte, first, is_ascii);
+            }
+
+            ISL_TARGET_AVX2 static auto decodeBasicPlane(const char *data, u16 *values) noexcept
+                -> void
+            {
+                const auto first = load(data);
+                const auto second = load(data + 1);
+                const auto third = load(data + 2);
+
+                store(
+                    values, decodeLanes(
+                                _mm256_cvtepu8_epi16(_mm256_castsi256_si128(first)),
+                                _mm256_cvtepu8_epi16(_mm256_castsi256_si128(second)),
+                                _mm256_cvtepu8_epi16(_mm256_castsi256_si128(third))));
+                store(
+                    values + 16, decodeLanes(
+                                     _mm256_cvtepu8_epi16(_mm256_extracti128_si256(first, 1)),
+                                     _mm256_cvtepu8_epi16(_mm256_extracti128_si256(second, 1)),
+                                     _mm256_cvtepu8_epi16(_mm256_extracti128_si256(third, 1))));
+            }
+
+            template<typename CharT>
+            ISL_TARGET_AVX2 static auto orCodeUnits(const CharT *data) noexcept -> Vector
+            {
+                constexpr auto units_in_vector = sizeof(Vector) / sizeof(CharT);
+                auto result = loadUnits(data);
+
+                for (auto i = units_in_vector; i != width; i += units_in_vector) {
+                    result = _mm256_or_si256(result, loadUnits(data + i));
+                }
+
+                return result;
+            }
+
+            ISL_TARGET_AVX2 static auto anyBits(const Vector units, const u32 bits) noexcept
+                -> bool
+            {
+                return _mm256_testz_si256(units, _mm256_set1_epi32(static_cast<int>(bits))) == 0;
+            }
+
+            // Packing works inside 128-bit lanes, permutation restores order of the halves.
+            ISL_TARGET_AVX2 static auto narrow(const char16_t *data, char *buffer) noexcept
+                -> void
+            {
+                const auto packed = _mm256_packus_epi16(loadUnits(data), loadUnits(data + 16));
+                store(buffer, _mm256_permute4x64_epi64(packed, 0xD8));
+            }
+
+            ISL_TARGET_AVX2 static auto narrow(const char32_t *data, char *buffer) noexcept
+                -> void
+            {
+                const auto low = _mm256_packs_epi32(loadUnits(data), loadUnits(data + 8));
+                const auto high = _mm256_packs_epi32(loadUnits(data + 16), loadUnits(data + 24));
+                const auto packed = _mm256_packus_epi16(low, high);
+
+                store(
+                    buffer,
+                    _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7)));
+            }
+        };
+
+        struct Avx2Kernels
+        {
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                findFirstInvalid(const char *data, const std::size_t size) noexcept
+                -> std::size_t
+            {
+                return findFirstInvalidKernel<Avx2>(data, size);
+            }
+
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                countCodePoints(const char *data, const std::size_t size) noexcept
+                -> std::size_t
+            {
+                return countCodePointsKernel<Avx2>(data, size);
+            }
+
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                utf16Size(const char *data, const std::size_t size) noexcept -> std::size_t
+            {
+                return utf16SizeKernel<Avx2>(data, size);
+            }
+
+            template<typename CharT>
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                decode(const char *data, const std::size_t size, CharT *buffer) noexcept
+                -> std::size_t
+            {
+                return decodeKernel<Avx2>(data, size, buffer);
+            }
+
+            template<typename CharT>
+            ISL_TARGET_AVX2 ISL_FLATTEN static auto
+                encode(const CharT *data, const std::size_t size, char *buffer) noexcept
+                -> std::size_t
+            {
+                return encodeKernel<Avx2>(data, size, buffer);
+            }
+        };
+#elif defined(ISL_SIMD_NEON)
+        struct Neon
+        {
+            using Vector = uint8x16_t;
+            using Block64 = uint8x16x4_t;
+
+            static constexpr std::size_t width = 16;
+            static constexpr bool hasShuffle = true;
+
+            ISL_INLINE static auto load(const char *data) noexcept -> Vector
+            {
+                return vld1q_u8(reinterpret_cast<const u8 *>(data));// NOLINT
+            }
+
+            ISL_INLINE static auto load64(const char *data) noexcept -> Block64
+            {
+                return {{load(data), load(data + 16), load(data + 32), load(data + 48)}};
+            }
+
+            ISL_INLINE static auto broadcast(const u8 value) noexcept -> Vector
+            {
+                return vdupq_n_u8(value);
+            }
+
+            ISL_INLINE static auto bitAnd(const Vector lhs, const Vector rhs) noexcept -> Vector
+            {
+                return vandq_u8(lhs, rhs);
+            }
+
+            ISL_INLINE static auto bitOr(const Vector lhs, const Vector rhs) noexcept -> Vector
+            {
+                return vorrq_u8(lhs, rhs);
+            }
+
+            ISL_INLINE static auto bitXor(const Vector lhs, const Vector rhs) noexcept -> Vector
+            {
+                return veorq_u8(lhs, rhs);
+            }
+
+            ISL_INLINE static auto subtractSaturated(const Vector lhs, const Vector rhs) noexcept
+                -> Vector
+            {
+                return vqsubq_u8(lhs, rhs);
+            }
+
+            ISL_INLINE static auto anySet(const Vector block) noexcept -> bool
+            {
+                return vmaxvq_u8(block) != 0;
+            }
+
+            ISL_INLINE static auto lowNibbles(const Vector block) noexcept -> Vector
+            {
+                return vandq_u8(block, vdupq_n_u8(0x0F));
+            }
+
+            ISL_INLINE static auto highNibbles(const Vector block) noexcept -> Vector
+            {
+                return vshrq_n_u8(block, 4);
+            }
+
+            ISL_INLINE static auto
+                lookup(const std::array<u8, 16> &table, const Vector indices) noexcept -> Vector
+            {
+                return vqtbl1q_u8(vld1q_u8(table.data()), indices);
+            }
+
+            template<int Count>
+            ISL_INLINE static auto shiftIn(const Vector input, const Vector previous) noexcept
+                -> Vector
+            {
+                return vextq_u8(previous, input, 16 - Count);
+            }
+
+            ISL_INLINE static auto isAscii(const Block64 &block) noexcept -> bool
+            {
+                const auto low = vorrq_u8(block.val[0], block.val[1]);
+                const auto high = vorrq_u8(block.val[2], block.val[3]);
+
+                return vmaxvq_u8(vorrq_u8(low, high)) < 0x80;
+            }
+
+            ISL_INLINE static auto hasErrors(const Block64 &block, const Vector previous) noexcept
+                -> bool
+            {
+                auto first = Vector{};
+                auto second = Vector{};
+                auto third = Vector{};
+                auto fourth = Vector{};
+                utf8Errors<Neon>(block.val[0], previous, first);
+                utf8Errors<Neon>(block.val[1], block.val[0], second);
+                utf8Errors<Neon>(block.val[2], block.val[1], third);
+                utf8Errors<Neon>(block.val[3], block.val[2], fourth);
+
+                return anySet(vorrq_u8(vorrq_u8(first, second), vorrq_u8(third, fourth)));
+            }
+
+            ISL_INLINE static auto lastVector(const Block64 &block) noexcept -> Vector
+            {
+                return block.val[3];
+            }
+
+            // Lead bytes are counted as ones, sums of four vectors fit into a byte.
+            ISL_INLINE static auto countLeadBytes(const Block64 &block) noexcept -> std::size_t
+            {
+                const auto threshold = vdupq_n_s8(-65);
+                const auto ones = vdupq_n_u8(1);
+
+                auto sum = vandq_u8(vcgtq_s8(vreinterpretq_s8_u8(block.val[0]), threshold), ones);
+
+                for (int i = 1; i != 4; ++i) {
+                    const auto is_lead = vcgtq_s8(vreinterpretq_s8_u8(block.val[i]), threshold);
+                    sum = vaddq_u8(sum, vandq_u8(is_lead, ones));
+                }
+
+                return vaddlvq_u8(sum);
+            }
+
+            ISL_INLINE static auto countFourByteLeads(const Block64 &block) noexcept
+                -> std::size_t
+            {
+                const auto threshold = vdupq_n_u8(0xF0);
+                const auto ones = vdupq_n_u8(1);
+
+                auto sum = vandq_u8(vcgeq_u8(block.val[0], threshold), ones);
+
+                for (int i = 1; i != 4; ++i) {
+                    sum = vaddq_u8(sum, vandq_u8(vcgeq_u8(block.val[i], threshold), ones));
+                }
+
+                return vaddlvq_u8(sum);
+            }
+        };
+#endif
+
+        struct KernelTable
+        {
+            std::size_t (*findFirstInvalidUtf8)(const char *, std::size_t) noexcept;
+            std::size_t (*countUtf8CodePoints)(const char *, std::size_t) noexcept;
+            std::size_t (*utf16SizeOfUtf8)(const char *, std::size_t) noexcept;
+            std::size_t (*decodeUtf8To16)(const char *, std::size_t, char16_t *) noexcept;
+            std::size_t (*decodeUtf8To32)(const char *, std::size_t, char32_t *) noexcept;
+            std::size_t (*encodeUtf16To8)(const char16_t *, std::size_t, char *) noexcept;
+            std::size_t (*encodeUtf32To8)(const char32_t *, std::size_t, char *) noexcept;
+        };
+
+        template<typename UnicodeKernels, typename TranscodingKernels>
+        constexpr auto makeKernelTable() noexcept -> KernelTable
+        {
+            return {
+                .findFirstInvalidUtf8 = &UnicodeKernels::findFirstInvalid,
+                .countUtf8CodePoints = &UnicodeKernels::countCodePoints,
+                .utf16SizeOfUtf8 = &UnicodeKernels::utf16Size,
+                .decodeUtf8To16 = &TranscodingKernels::template decode<char16_t>,
+                .decodeUtf8To32 = &TranscodingKernels::template decode<char32_t>,
+                .encodeUtf16To8 = &TranscodingKernels::template encode<char16_t>,
+                .encodeUtf32To8 = &TranscodingKernels::template encode<char32_t>,
+            };
+        }
+
+        auto detectKernels() noexcept -> KernelTable
+        {
+#if defined(ISL_SIMD_X86)
+            if (hasAvx2()) {
+                return makeKernelTable<Avx2Kernels, Avx2Kernels>();
+            }
+
+            return makeKernelTable<Kernels<Sse2>, Kernels<Sse2>>();
+#elif defined(ISL_SIMD_NEON)
+            // transcoding kernels are implemented for SSE2 and AVX2 only
+            return makeKernelTable<Kernels<Neon>, Scalar>();
+#else
+            return makeKernelTable<Scalar, Scalar>();
+#endif
+        }
+
+        auto getKernels() noexcept -> KernelTable &
+        {
+            static auto kernels = detectKernels();
+            return kernels;
+        }
+    }// namespace
+
+    ISL_SIMD_KERNELS_END
+
+    auto selectKernels(const KernelSet kernel_set) noexcept -> bool
+    {
+        switch (kernel_set) {
+        case KernelSet::DETECTED:
+            getKernels() = detectKernels();
+            return true;
+
+#if defined(ISL_SIMD_X86)
+        case KernelSet::AVX2:
+            if (!hasAvx2()) {
+                return false;
+            }
+
+            getKernels() = makeKernelTable<Avx2Kernels, Avx2Kernels>();
+            return true;
+
+        case KernelSet::SSE2:
+            getKernels() = makeKernelTable<Kernels<Sse2>, Kernels<Sse2>>();
+            return true;
+#elif defined(ISL_SIMD_NEON)
+        case KernelSet::NEON:
+            getKernels() = makeKernelTable<Kernels<Neon>, Scalar>();
+            return true;
+#endif
+
+        case KernelSet::SCALAR:
+            getKernels() = makeKernelTable<Scalar, Scalar>();
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+    auto findFirstInvalidUtf8(const char *data, const std::size_t size) noexcept -> std::size_t
+    {
+        return getKernels().findFirstInvalidUtf8(data, size);
+    }
+
+    auto countUtf8CodePoints(const char *data, const std::size_t size) noexcept -> std::size_t
+    {
+        return getKernels().countUtf8CodePoints(data, size);
+    }
+
+    auto utf16SizeOfUtf8(const char *data, const std::size_t size) noexcept -> std::size_t
+    {
+        return getKernels().utf16SizeOfUtf8(data, size);
+    }
+
+    auto decodeUtf8(const char *data, const std::size_t size, char16_t *buffer) noexcept
+        -> std::size_t
+    {
+        return getKernels().decodeUtf8To16(data, size, buffer);
+    }
+
+    auto decodeUtf8(const char *data, const std::size_t size, char32_t *buffer) noexcept
+        -> std::size_t
+    {
+        return getKernels().decodeUtf8To32(data, size, buffer);
+    }
+
+    auto encodeUtf8(const char16_t *data, const std::size_t size, char *buffer) noexcept
+        -> std::size_t
+    {
+        return getKernels().encodeUtf16To8(data, size, buffer);
+    }
+
+    auto encodeUtf8(const char32_t *data, const std::size_t size, char *buffer) noexcept
+        -> std::size_t
+    {
+        return getKernels().encodeUtf32To8(data, size, buffer);
+    }
+}// namespace isl::detail::unicode
@@ -2,60 +2,370 @@
 
 namespace isl
 {
+    namespace
+    {
+        auto toByteSet(const std::bitset<UtfSet::asciiStorageSize> &ascii_symbols)
+            -> detail::string_search::ByteSet
+        {
+            auto result = detail::string_search::ByteSet{};
+
+            for (std::size_t chr = 0; chr != ascii_symbols.size(); ++chr) {
+                if (ascii_symbols.test(chr)) {
+                    result.add(as<u8>(chr));
+                }
+            }
+
+            return result;
+        }
+
+        // Walks over boundaries of both sets in order and keeps those, where the result of the
+        // operation changes.
+        template<typename Operation>
+        auto combineBoundaries(
+            const std::vector<char32_t> &lhs, const std::vector<char32_t> &rhs,
+            Operation operation) -> std::vector<char32_t>
+        {
+            auto result = std::vector<char32_t>{};
+            auto lhs_index = std::size_t{};
+            auto rhs_index = std::size_t{};
+            auto in_lhs = false;
+            auto in_rhs = false;
+            auto in_result = false;
+
+            result.reserve(lhs.size() + rhs.size());
+
+            while (lhs_index != lhs.size() || rhs_index != rhs.size()) {
+                const auto lhs_boundary =
+                    lhs_index != lhs.size() ? lhs[lhs_index] : UtfSet::codePointsEnd + 1;
+                const auto rhs_boundary =
+                    rhs_index != rhs.size() ? rhs[rhs_index] : UtfSet::codePointsEnd + 1;
+                const auto boundary = std::min(lhs_boundary, rhs_boundary);
+
+                if (lhs_boundary == boundary) {
+                    in_lhs = !in_lhs;
+                    ++lhs_index;
+                }
+
+                if (rhs_boundary == boundary) {
+                    in_rhs = !in_rhs;
+                    ++rhs_index;
+                }
+
+                if (operation(in_lhs, in_rhs) != in_result) {
+                    in_result = !in_result;
+                    result.emplace_back(boundary);
+                }
+            }
+
+            return result;
+        }
+    }// namespace
+
+    namespace detail
+    {
+        auto UtfSetTables::classify(
+            const std::span<const char32_t> chars, const std::span<u64> bits) const -> void
+        {
+            constexpr auto block_size = std::size_t{64};
+
+            if (bits.size() < (chars.size() + block_size - 1) / block_size) {
+                throw std::length_error{fmt::format(
+                    "UtfSet::classify needs {} words for {} characters, but got {}",
+                    (chars.size() + block_size - 1) / block_size, chars.size(), bits.size())};
+            }
+
+            // Code points are narrowed to bytes, so ASCII ones are tested by a vectorized set
+            // search. Others become 0x80, which is never in the ASCII set, and are looked up one
+            // by one.
+            constexpr auto non_ascii = static_cast<char>(0x80);
+            auto bytes = std::array<char, block_size>{};
+
+            for (std::size_t block = 0; block < chars.size(); block += block_size) {
+                const auto count = std::min(chars.size() - block, block_size);
+
+                for (std::size_t i = 0; i != count; ++i) {
+                    const auto chr = chars[block + i];
+                    bytes[i] = chr < 128 ? static_cast<char>(chr) : non_ascii;
+                }
+
+                auto mask = string_search::setMask64(bytes.data(), count, *ascii);
+                auto others = string_search::equalMask64(bytes.data(), count, non_ascii);
+
+                for (; others != 0; others &= others - 1) {
+                    const auto i = as<std::size_t>(std::countr_zero(others));
+                    mask |= as<u64>(at(chars[block + i])) << i;
+                }
+
+                bits[block / block_size] = mask;
+            }
+        }
+
+        auto UtfSetTables::spanWhile(const string_view str) const noexcept -> std::size_t
+        {
+            const auto *data = str.data();
+            const auto size = str.size();
+            auto position = std::size_t{};
+
+            while (true) {
+                // runs of ASCII characters from the set are skipped by vectorized search
+                const auto ascii_end =
+                    string_search::findFirstNotOf(data + position, size - position, *ascii);
+
+                if (ascii_end == string_search::npos) {
+                    return size;
+                }
+
+                position += ascii_end;
+
+                if (utf8::isOneByteSize(data[position])) {
+                    return position;
+                }
+
+                do {
+                    const auto sequence_size =
+                        utf8::detail::validSequenceSize(data + position, size - position);
+
+                    if (sequence_size == 0
+                        || !at(
+                            utf8::detail::decodeCodePoint(data + position, sequence_size))) {
+                        return position;
+                    }
+
+                    position += sequence_size;
+                } while (position != size && !utf8::isOneByteSize(data[position]));
+
+                if (position == size) {
+                    return size;
+                }
+            }
+        }
+    }// namespace detail
+
     UtfSet::UtfSet(
         const std::bitset<asciiStorageSize>
             ascii_symbols,
-        ankerl::unordered_dense::set<char32_t>
-            non_ascii_symbols)
-      : asciiSymbolsStorage{ascii_symbols}
-      , nonAsciiStorage{std::move(non_ascii_symbols)}
-    {}
+        const ankerl::unordered_dense::set<char32_t>
+            &non_ascii_symbols)
+      : asciiSymbols{toByteSet(ascii_symbols)}
+    {
+        auto symbols = std::vector<char32_t>{non_ascii_symbols.begin(), non_ascii_symbols.end()};
+        std::ranges::sort(symbols);
+
+        for (const char32_t chr : symbols) {
+            appendSorted(chr, chr + 1);
+        }
+
+        updatePages();
+    }
 
     UtfSet::UtfSet(
         const std::bitset<asciiStorageSize>
             ascii_symbols,
         const std::vector<Range<char32_t>> &ranges)
-      : asciiSymbolsStorage{ascii_symbols}
+      : asciiSymbols{toByteSet(ascii_symbols)}
     {
-        for (const auto range : ranges) {
-            set(range, true);
-        }
-    }
+        auto sorted_ranges = ranges;
 
-    auto UtfSet::at(const char32_t chr) const noexcept -> bool
-    {
-        if (chr < asciiStorageSize) {
-            return asciiSymbolsStorage.test(chr);
+        std::ranges::sort(sorted_ranges, {}, [](const Range<char32_t> range) {
+            return range.getFrom();
+        });
+
+        for (const auto range : sorted_ranges) {
+            appendSorted(range.getFrom(), range.getTo());
         }
 
-        return nonAsciiStorage.contains(chr);
+        updatePages();
     }
 
     auto UtfSet::set(char32_t chr, bool value) -> void
     {
         if (chr < asciiStorageSize) {
-            asciiSymbolsStorage.set(chr, value);
+            setAscii(as<u8>(chr), value);
             return;
         }
 
-        setBigChar(chr, value);
+        setBigChars(chr, chr + 1, value);
     }
 
     auto UtfSet::set(const Range<char32_t> range, const bool value) -> void
     {
-        ISL_UNROLL_N(4)
-        for (const char32_t chr : range) {
-            set(chr, value);
+        auto first = range.getFrom();
+        const auto last = range.getTo();
+
+        for (; first < last && first < asciiStorageSize; ++first) {
+            setAscii(as<u8>(first), value);
+        }
+
+        if (first < last) {
+            setBigChars(first, last, value);
+        }
+    }
+
+    auto UtfSet::fromBoundaries(
+        const detail::string_search::ByteSet &ascii_symbols, std::vector<char32_t> boundaries)
+        -> UtfSet
+    {
+        auto result = UtfSet{};
+        result.asciiSymbols = ascii_symbols;
+        result.nonAsciiBoundaries = std::move(boundaries);
+        result.updatePages();
+
+        return result;
+    }
+
+    template<typename Operation>
+    auto UtfSet::combine(const UtfSet &lhs, const UtfSet &rhs, Operation operation) -> UtfSet
+    {
+        auto ascii_symbols = detail::string_search::ByteSet{};
+
+        for (u8 chr = 0; chr != asciiStorageSize; ++chr) {
+            if (operation(lhs.asciiSymbols.contains(chr), rhs.asciiSymbols.contains(chr))) {
+                ascii_symbols.add(chr);
+            }
         }
+
+        return fromBoundaries(
+            ascii_symbols,
+            combineBoundaries(lhs.nonAsciiBoundaries, rhs.nonAsciiBoundaries, operation));
     }
 
-    auto UtfSet::setBigChar(const char32_t chr, const bool value) -> void
+    auto operator|(const UtfSet &lhs, const UtfSet &rhs) -> UtfSet
+    {
+        return UtfSet::combine(lhs, rhs, [](const bool in_lhs, const bool in_rhs) {
+            return in_lhs || in_rhs;
+        });
+    }
+
+    auto operator&(const UtfSet &lhs, const UtfSet &rhs) -> UtfSet
+    {
+        return UtfSet::combine(lhs, rhs, [](const bool in_lhs, const bool in_rhs) {
+            return in_lhs && in_rhs;
+        });
+    }
+
+    auto operator-(const UtfSet &lhs, const UtfSet &rhs) -> UtfSet
+    {
+        return UtfSet::combine(lhs, rhs, [](const bool in_lhs, const bool in_rhs) {
+            return in_lhs && !in_rhs;
+        });
+    }
+
+    auto UtfSet::operator~() const -> UtfSet
+    {
+        auto all_ascii = std::bitset<asciiStorageSize>{};
+        all_ascii.set();
+
+        const auto universe =
+            fromBoundaries(toByteSet(all_ascii), {asciiStorageSize, codePointsEnd});
+        return universe - *this;
+    }
+
+    auto UtfSet::operator|=(const UtfSet &other) -> UtfSet &
+    {
+        return *this = *this | other;
+    }
+
+    auto UtfSet::operator&=(const UtfSet &other) -> UtfSet &
+    {
+        return *this = *this & other;
+    }
+
+    auto UtfSet::operator-=(const UtfSet &other) -> UtfSet &
+    {
+        return *this = *this - other;
+    }
+
+    auto UtfSet::setAscii(const u8 chr, const bool value) -> void
     {
         if (value) {
-            nonAsciiStorage.insert(chr);
+            asciiSymbols.add(chr);
+        } else {
+            asciiSymbols.remove(chr);
+        }
+    }
+
+    auto UtfSet::setBigChars(const char32_t first, const char32_t last, const bool value) -> void
+    {
+        // Boundaries from first to last are dropped. Ends of the range stay boundaries only where
+        // membership changes on them, so touching intervals are merged.
+        const auto begin_index = detail::countBoundariesNotGreater(nonAsciiBoundaries, first - 1);
+        const auto end_index = detail::countBoundariesNotGreater(nonAsciiBoundaries, last);
+
+        auto replacement = std::array<char32_t, 2>{};
+        auto replacement_size = std::size_t{};
+
+        if (begin_index % 2 == static_cast<std::size_t>(!value)) {
+            replacement[replacement_size++] = first;
+        }
+
+        if (end_index % 2 == static_cast<std::size_t>(!value)) {
+            replacement[replacement_size++] = last;
+        }
+
+        const auto boundaries_begin = nonAsciiBoundaries.begin();
+
+        nonAsciiBoundaries.erase(
+            boundaries_begin + as<std::ptrdiff_t>(begin_index),
+            boundaries_begin + as<std::ptrdiff_t>(end_index));
+
+        nonAsciiBoundaries.insert(
+            nonAsciiBoundaries.begin() + as<std::ptrdiff_t>(begin_index), replacement.begin(),
+            replacement.begin() + as<std::ptrdiff_t>(replacement_size));
+
+        // boundaries before the range are kept, so are the pages starting not after it
+        updatePages((first >> detail::UtfSetPageBits) + 1, begin_index);
+    }
+
+    auto UtfSet::appendSorted(char32_t first, const char32_t last) -> void
+    {
+        for (; first < last && first < asciiStorageSize; ++first) {
+            asciiSymbols.add(as<u8>(first));
+        }
+
+        if (first >= last) {
+            return;
+        }
+
+        // ranges come in order of their starts, so only the last interval can touch the range
+        if (!nonAsciiBoundaries.empty() && first <= nonAsciiBoundaries.back()) {
+            nonAsciiBoundaries.back() = std::max(nonAsciiBoundaries.back(), last);
             return;
         }
 
-        nonAsciiStorage.erase(chr);
+        nonAsciiBoundaries.emplace_back(first);
+        nonAsciiBoundaries.emplace_back(last);
+    }
+
+    auto UtfSet::updatePages(std::size_t first_page, std::size_t boundary) -> void
+    {
+        // pages end after the page of the last boundary in the BMP, the last page holds the rest
+        const auto bmp_boundaries = detail::countBoundariesNotGreater(nonAsciiBoundaries, 0xFFFF);
+
+        if (bmp_boundaries == 0) {
+            pageBoundariesBegin.clear();
+            return;
+        }
+
+        const auto old_size = pageBoundariesBegin.size();
+
+        pageBoundariesBegin.resize(
+            (nonAsciiBoundaries[bmp_boundaries - 1] >> detail::UtfSetPageBits) + 2);
+
+        // added pages are counted as well, the last old page starts before them
+        if (first_page > old_size) {
+            first_page = old_size;
+            boundary = old_size == 0 ? 0 : pageBoundariesBegin[old_size - 1];
+        }
+
+        for (std::size_t page = first_page; page < pageBoundariesBegin.size(); ++page) {
+            const auto page_begin = as<char32_t>(page << detail::UtfSetPageBits);
+
+            while (boundary != nonAsciiBoundaries.size()
+                   && nonAsciiBoundaries[boundary] < page_begin) {
+                ++boundary;
+            }
+
+            pageBoundariesBegin[page] = as<u32>(boundary);
+        }
     }
 }// namespace isl